@@ -9,9 +9,12 @@ set -euo pipefail
 
 # Deterministic initramfs bake script
 # - respects SOURCE_DATE_EPOCH for file mtimes
-# - uses gzip -n to strip timestamps
+# - strips timestamps from the compressed archive
 # - builds Go and C artifacts without build IDs or paths
 # - supports injecting additional files via --copy host_path:guest_path
+# - supports gzip (default), zstd, and lz4 compression; zstd/lz4 trade a
+#   little ratio for much faster guest-side decompression, which is dead
+#   time before init.c even runs
 
 ROOT_DIR=$(cd "$(dirname "$0")" && pwd)
 
@@ -19,21 +22,26 @@ ROOT_DIR=$(cd "$(dirname "$0")" && pwd)
 BUSYBOX_URL=${BUSYBOX_URL:-"https://busybox.net/downloads/binaries/1.35.0-x86_64-linux-musl/busybox"}
 BUSYBOX_SHA256=${BUSYBOX_SHA256:-"6e123e7f3202a8c1e9b1f94d8941580a25135382b99e8d3e34fb858bba311348"}
 SDE=${SOURCE_DATE_EPOCH:-"0"}
+COMPRESSION=${INITRAMFS_COMPRESSION:-"gzip"}
 
 COPIES=()
 
 usage() {
   cat <<EOF
-Usage: $0 [--copy host_path:guest_path]...
+Usage: $0 [--copy host_path:guest_path]... [--compression gzip|zstd|lz4]
 
 Options:
   --copy host_path:guest_path   Copy a file or directory from host into the initramfs at guest_path.
                                 May be provided multiple times. Directories are copied recursively.
+  --compression algo            Archive compression: gzip (default), zstd, or lz4.
+                                The kernel must be built with the matching RD_* /
+                                INITRAMFS_COMPRESSION_* config.
 
 Environment:
-  BUSYBOX_URL        URL to busybox static binary (musl). Default: $BUSYBOX_URL
-  BUSYBOX_SHA256     Expected SHA-256 of busybox (empty to skip verification)
-  SOURCE_DATE_EPOCH  Unix timestamp used for normalized mtimes (default: 0)
+  BUSYBOX_URL             URL to busybox static binary (musl). Default: $BUSYBOX_URL
+  BUSYBOX_SHA256          Expected SHA-256 of busybox (empty to skip verification)
+  SOURCE_DATE_EPOCH       Unix timestamp used for normalized mtimes (default: 0)
+  INITRAMFS_COMPRESSION   Same as --compression (default: gzip)
 EOF
 }
 
@@ -47,6 +55,13 @@ while [ $# -gt 0 ]; do
     --copy=*)
       COPIES+=("${1#*=}")
       ;;
+    --compression)
+      shift || { echo "--compression requires an argument" >&2; exit 2; }
+      COMPRESSION="$1"
+      ;;
+    --compression=*)
+      COMPRESSION="${1#*=}"
+      ;;
     -h|--help)
       usage; exit 0
       ;;
@@ -58,6 +73,32 @@ while [ $# -gt 0 ]; do
   shift || true
 done
 
+# Pick compressor/decompressor up front so a bad selection fails fast.
+# Flags are chosen for determinism (no timestamps, single stream) and
+# the kernel's decompressors: lz4 needs the legacy frame format (-l).
+case "$COMPRESSION" in
+  gzip)
+    EXT=gz
+    COMPRESS=(gzip -n -9)
+    DECOMPRESS=(gzip -dc)
+    ;;
+  zstd)
+    EXT=zst
+    COMPRESS=(zstd -q -19 -c)
+    DECOMPRESS=(zstd -dc)
+    ;;
+  lz4)
+    EXT=lz4
+    COMPRESS=(lz4 -q -l -9 -c)
+    DECOMPRESS=(lz4 -dc)
+    ;;
+  *)
+    echo "Unknown compression '$COMPRESSION' (expected gzip, zstd, or lz4)" >&2
+    exit 2
+    ;;
+esac
+command -v "${COMPRESS[0]}" >/dev/null || { echo "${COMPRESS[0]} not installed" >&2; exit 2; }
+
 echo "Using BUSYBOX_URL=$BUSYBOX_URL"
 if [[ -n "$BUSYBOX_SHA256" ]]; then
   echo "Expecting BUSYBOX_SHA256=$BUSYBOX_SHA256"
@@ -140,12 +181,31 @@ fi
 # 4) Normalize mtimes for reproducibility
 find "$WORKDIR" -exec touch -h -d @"$SDE" {} +
 
-# 5) Create the final initramfs archive (gzip -n to drop timestamps)
+# 5) Create the final initramfs archive
+CPIO_FILE="$ROOT_DIR/volant-initramfs.cpio"
+ARCHIVE="$ROOT_DIR/volant-initramfs.cpio.$EXT"
 pushd "$WORKDIR" >/dev/null
-find . -print0 | cpio --null -ov --format=newc | gzip -n -9 > "$ROOT_DIR/volant-initramfs.cpio.gz"
+find . -print0 | cpio --null -ov --format=newc > "$CPIO_FILE"
 popd >/dev/null
-
-echo "Initramfs written to $ROOT_DIR/volant-initramfs.cpio.gz"
-echo "Next step: rebuild the Cloud Hypervisor Linux kernel with CONFIG_INITRAMFS_SOURCE pointing to this archive."
+"${COMPRESS[@]}" < "$CPIO_FILE" > "$ARCHIVE"
+
+# 6) Size/decompression report. The host-side decompression time is a
+# proxy for the guest-side cost paid before init.c runs; track it per
+# build so compression changes show up as numbers, not vibes.
+RAW_BYTES=$(stat -c%s "$CPIO_FILE")
+COMPRESSED_BYTES=$(stat -c%s "$ARCHIVE")
+START_NS=$(date +%s%N)
+"${DECOMPRESS[@]}" < "$ARCHIVE" > /dev/null
+END_NS=$(date +%s%N)
+echo "--- initramfs report ---"
+echo "compression:        $COMPRESSION"
+echo "uncompressed bytes: $RAW_BYTES"
+echo "compressed bytes:   $COMPRESSED_BYTES ($((COMPRESSED_BYTES * 100 / RAW_BYTES))% of raw)"
+echo "host decompress:    $(( (END_NS - START_NS) / 1000000 )) ms"
+echo "------------------------"
+
+echo "Initramfs written to $ARCHIVE (uncompressed cpio kept at $CPIO_FILE)"
+echo "Next step: rebuild the Cloud Hypervisor Linux kernel with CONFIG_INITRAMFS_SOURCE pointing to the uncompressed cpio"
+echo "and CONFIG_INITRAMFS_COMPRESSION_${COMPRESSION^^} (plus the matching CONFIG_RD_*) enabled."
 echo "Kernel repo: https://github.com/cloud-hypervisor/linux"
 echo "Place the resulting bzImage under kernels/x86_64/bzImage in this repo or install to /var/lib/volant/kernel/bzImage on target hosts."
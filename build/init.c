@@ -6,12 +6,51 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <fcntl.h>
+#include <time.h>
 #include <sys/wait.h>
 #include <sys/mount.h>
 #include <sys/stat.h>
 #include <sys/reboot.h>
 #include <sys/sysmacros.h>
 
+// Boot phase marks, stamped with CLOCK_MONOTONIC so kestrel can line its
+// own marks up against ours on the same clock. We buffer them in memory
+// because the early phases run before /run (for the file) and the
+// console (for printing) exist, and flush right before the handoff.
+#define MAX_BOOT_MARKS 8
+#define BOOT_MARKS_FILE "/run/volant-boot-marks"
+
+static struct {
+    const char *phase;
+    long long us;
+} boot_marks[MAX_BOOT_MARKS];
+static int boot_mark_count;
+
+static void boot_mark(const char *phase) {
+    struct timespec ts;
+    if (clock_gettime(CLOCK_MONOTONIC, &ts))
+        return;
+    if (boot_mark_count >= MAX_BOOT_MARKS)
+        return;
+    boot_marks[boot_mark_count].phase = phase;
+    boot_marks[boot_mark_count].us =
+        (long long)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+    boot_mark_count++;
+}
+
+static void flush_boot_marks(void) {
+    FILE *f = fopen(BOOT_MARKS_FILE, "w");
+    for (int i = 0; i < boot_mark_count; i++) {
+        printf("C INIT: boot-mark %s %lld.%06llds\n", boot_marks[i].phase,
+               boot_marks[i].us / 1000000, boot_marks[i].us % 1000000);
+        if (f)
+            fprintf(f, "%s %lld\n", boot_marks[i].phase, boot_marks[i].us);
+    }
+    if (f)
+        fclose(f);
+    fflush(stdout);
+}
+
 // A proper shutdown function
 __attribute__((noreturn)) static void poweroff(void) {
     fflush(stdout);
@@ -68,6 +107,8 @@ static void mount_filesystems(void) {
 }
 
 int main(int argc, char *argv[]) {
+    boot_mark("init-start");
+
     // Create a basic directory structure first
     mkdir("/proc", 0755);
     mkdir("/sys", 0755);
@@ -76,14 +117,18 @@ int main(int argc, char *argv[]) {
 
     // Set up the essential filesystems
     mount_filesystems();
+    boot_mark("filesystems-mounted");
 
     // Now that /dev is mounted, ensure we have a console
     ensure_console();
+    boot_mark("console-ready");
 
     printf("C INIT: Basic environment is up. Handing off to kestrel...\n");
 
     // Hand over control to our real Go init program.
     // This will now become the new PID 1.
+    boot_mark("kestrel-exec");
+    flush_boot_marks();
     char *const kestrel_argv[] = {"/bin/kestrel", NULL};
     execv("/bin/kestrel", kestrel_argv);
 
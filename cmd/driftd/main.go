@@ -77,7 +77,7 @@ func main() {
 	}
 
 	handler := httpapi.New(ctrl)
-	daemon := app.New(cfg, logger, handler)
+	daemon := app.New(cfg, logger, handler, httpapi.Metrics(ctrl))
 
 	if err := daemon.Run(ctx); err != nil && !errors.Is(err, context.Canceled) {
 		logger.Error("daemon exit", "error", err)
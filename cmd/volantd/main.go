@@ -81,16 +81,19 @@ func main() {
 	events := memory.New()
 
 	engine, err := orchestrator.New(orchestrator.Params{
-		Store:            store,
-		Logger:           logger,
-		Subnet:           subnet,
-		HostIP:           hostIP,
-		APIListenAddr:    cfg.APIListenAddr,
-		APIAdvertiseAddr: cfg.APIAdvertiseAddr,
-		Launcher:         launcher,
-		Network:          netManager,
-		Bus:              events,
-		RuntimeDir:       runtimeDir,
+		Store:             store,
+		Logger:            logger,
+		Subnet:            subnet,
+		HostIP:            hostIP,
+		APIListenAddr:     cfg.APIListenAddr,
+		APIAdvertiseAddr:  cfg.APIAdvertiseAddr,
+		Launcher:          launcher,
+		Network:           netManager,
+		Bus:               events,
+		RuntimeDir:        runtimeDir,
+		DeployParallelism: cfg.DeployParallelism,
+		WarmPoolSize:      cfg.WarmPoolSize,
+		VMSnapshots:       cfg.VMSnapshots,
 	})
 	if err != nil {
 		logger.Error("init orchestrator", "error", err)
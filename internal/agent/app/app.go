@@ -6,7 +6,6 @@
 package app
 
 import (
-	"bytes"
 	"context"
 	"encoding/json"
 	"errors"
@@ -14,6 +13,7 @@ import (
 	"io"
 	"log"
 	"net/http"
+	"net/http/httputil"
 	"net/url"
 	"os"
 	"os/exec"
@@ -30,6 +30,14 @@ import (
 	"github.com/mdlayher/vsock"
 
 	"github.com/volantvm/volant/internal/pluginspec"
+	"github.com/volantvm/volant/internal/telemetry"
+)
+
+// workloadProxyDuration tracks end-to-end latency of requests proxied to
+// the workload, exported on the agent's /metrics endpoint.
+var workloadProxyDuration = telemetry.NewHistogram(
+	"kestrel_workload_proxy_duration_seconds",
+	"Time to proxy a workload request end to end.",
 )
 
 const (
@@ -65,8 +73,10 @@ type App struct {
 	timeout        time.Duration
 	log            *log.Logger
 	started        time.Time
+	boot           *bootTimeline
 	manifest       *pluginspec.Manifest
 	client         *http.Client
+	proxy          *httputil.ReverseProxy
 	ctx            context.Context
 	mu             sync.Mutex
 	workloadCmd    *exec.Cmd
@@ -93,14 +103,17 @@ func Run(ctx context.Context) error {
 	cfg := loadConfig()
 	logger := log.New(os.Stdout, "kestrel: ", log.LstdFlags|log.LUTC)
 
+	transport := newWorkloadTransport()
 	app := &App{
 		cfg:     cfg,
 		timeout: cfg.DefaultTimeout,
 		log:     bootLog,
 		started: time.Now().UTC(),
-		client:  &http.Client{Timeout: cfg.DefaultTimeout + 30*time.Second},
+		boot:    newBootTimeline(),
+		client:  &http.Client{Transport: transport, Timeout: cfg.DefaultTimeout + 30*time.Second},
 		ctx:     ctx,
 	}
+	app.proxy = app.newWorkloadProxy(transport)
 
 	defer app.stopShell()
 
@@ -125,6 +138,7 @@ func Run(ctx context.Context) error {
 	}
 	if manifest != nil {
 		app.manifest = manifest
+		app.boot.mark("manifest-resolved")
 	} else {
 		logger.Printf("no manifest received at startup; waiting for configuration")
 	}
@@ -158,8 +172,11 @@ func (a *App) run(ctx context.Context) error {
 	router.Use(middleware.Timeout(a.timeout + 30*time.Second))
 
 	router.Get("/healthz", a.handleHealth)
+	router.Method(http.MethodGet, "/metrics", telemetry.Handler())
+	router.Mount("/debug", middleware.Profiler())
 
 	router.Route("/v1", func(r chi.Router) {
+		r.Get("/boot-timeline", a.handleBootTimeline)
 		if err := a.mountManifestRoutes(r); err != nil {
 			a.log.Printf("manifest route mount error: %v", err)
 		}
@@ -671,53 +688,65 @@ func (a *App) mountManifestRoutes(router chi.Router) error {
 	return nil
 }
 
-func (a *App) forwardManifestAction(base *url.URL, actionPath string, timeout time.Duration, actionName string) http.HandlerFunc {
-	return func(w http.ResponseWriter, req *http.Request) {
-		ctx := req.Context()
-		if timeout > 0 {
-			var cancel context.CancelFunc
-			ctx, cancel = context.WithTimeout(ctx, timeout)
-			defer cancel()
-		}
-
-		body, err := io.ReadAll(req.Body)
-		if err != nil {
-			errorJSON(w, http.StatusBadRequest, err)
-			return
-		}
-		_ = req.Body.Close()
+// newWorkloadTransport returns the shared transport for the loopback hop
+// to the workload: keep-alives pool connections so each forwarded request
+// skips TCP setup.
+func newWorkloadTransport() *http.Transport {
+	return &http.Transport{
+		MaxIdleConns:        64,
+		MaxIdleConnsPerHost: 64,
+		IdleConnTimeout:     90 * time.Second,
+	}
+}
 
-		rel := &url.URL{Path: actionPath, RawQuery: req.URL.RawQuery}
-		target := base.ResolveReference(rel)
+// proxyBufferPool recycles copy buffers across proxied requests so body
+// passthrough does not allocate per call.
+type proxyBufferPool struct {
+	pool sync.Pool
+}
 
-		proxyReq, err := http.NewRequestWithContext(ctx, req.Method, target.String(), bytes.NewReader(body))
-		if err != nil {
-			errorJSON(w, http.StatusBadGateway, err)
-			return
-		}
-		copyHeaders(proxyReq.Header, req.Header)
+func newProxyBufferPool() *proxyBufferPool {
+	return &proxyBufferPool{pool: sync.Pool{New: func() any {
+		buf := make([]byte, 32*1024)
+		return &buf
+	}}}
+}
 
-		resp, err := a.client.Do(proxyReq)
-		if err != nil {
+func (p *proxyBufferPool) Get() []byte  { return *p.pool.Get().(*[]byte) }
+func (p *proxyBufferPool) Put(b []byte) { p.pool.Put(&b) }
+
+// newWorkloadProxy builds the shared reverse proxy used by both manifest
+// action routes and the workload passthrough. Handlers resolve the target
+// and set req.URL before handing off; bodies stream straight through
+// without intermediate buffering, and FlushInterval -1 keeps streaming
+// responses (SSE, chunked) flowing immediately.
+func (a *App) newWorkloadProxy(transport *http.Transport) *httputil.ReverseProxy {
+	return &httputil.ReverseProxy{
+		Rewrite: func(pr *httputil.ProxyRequest) {
+			pr.Out.URL = pr.In.URL
+			pr.Out.Host = ""
+		},
+		Transport:     transport,
+		BufferPool:    newProxyBufferPool(),
+		FlushInterval: -1,
+		ErrorHandler: func(w http.ResponseWriter, req *http.Request, err error) {
+			a.log.Printf("workload proxy %s %s: %v", req.Method, req.URL.Path, err)
 			errorJSON(w, http.StatusBadGateway, err)
-			return
-		}
-		defer resp.Body.Close()
-
-		copyHeaders(w.Header(), resp.Header)
-		w.WriteHeader(resp.StatusCode)
-		if _, err := io.Copy(w, resp.Body); err != nil {
-			a.log.Printf("manifest action %s proxy error: %v", actionName, err)
-		}
+		},
 	}
 }
 
-func copyHeaders(dst, src http.Header) {
-	dst.Del("Host")
-	for key, values := range src {
-		for _, value := range values {
-			dst.Add(key, value)
+func (a *App) forwardManifestAction(base *url.URL, actionPath string, timeout time.Duration, actionName string) http.HandlerFunc {
+	return func(w http.ResponseWriter, req *http.Request) {
+		if timeout > 0 {
+			ctx, cancel := context.WithTimeout(req.Context(), timeout)
+			defer cancel()
+			req = req.WithContext(ctx)
 		}
+
+		rel := &url.URL{Path: actionPath, RawQuery: req.URL.RawQuery}
+		req.URL = base.ResolveReference(rel)
+		a.proxy.ServeHTTP(w, req)
 	}
 }
 
@@ -790,47 +819,21 @@ func (a *App) mountWorkloadPassthrough(router chi.Router, base *url.URL) {
 
 func (a *App) forwardWorkload(base *url.URL, timeout time.Duration, stripPrefix string) http.HandlerFunc {
 	return func(w http.ResponseWriter, req *http.Request) {
-		ctx := req.Context()
+		defer workloadProxyDuration.ObserveSince(time.Now())
 		if timeout > 0 {
-			var cancel context.CancelFunc
-			ctx, cancel = context.WithTimeout(ctx, timeout)
+			ctx, cancel := context.WithTimeout(req.Context(), timeout)
 			defer cancel()
+			req = req.WithContext(ctx)
 		}
 
-		body, err := io.ReadAll(req.Body)
-		if err != nil {
-			errorJSON(w, http.StatusBadRequest, err)
-			return
-		}
-		_ = req.Body.Close()
-
 		path := req.URL.Path
 		if stripPrefix != "" {
 			path = strings.TrimPrefix(path, stripPrefix)
 		}
 		path = strings.TrimSpace(path)
 
-		target := resolveWorkloadURL(base, path, req.URL.RawQuery)
-
-		proxyReq, err := http.NewRequestWithContext(ctx, req.Method, target.String(), bytes.NewReader(body))
-		if err != nil {
-			errorJSON(w, http.StatusBadGateway, err)
-			return
-		}
-		copyHeaders(proxyReq.Header, req.Header)
-
-		resp, err := a.client.Do(proxyReq)
-		if err != nil {
-			errorJSON(w, http.StatusBadGateway, err)
-			return
-		}
-		defer resp.Body.Close()
-
-		copyHeaders(w.Header(), resp.Header)
-		w.WriteHeader(resp.StatusCode)
-		if _, err := io.Copy(w, resp.Body); err != nil {
-			a.log.Printf("workload proxy error: %v", err)
-		}
+		req.URL = resolveWorkloadURL(base, path, req.URL.RawQuery)
+		a.proxy.ServeHTTP(w, req)
 	}
 }
 
@@ -946,12 +949,15 @@ func (a *App) startWorkload() error {
 	a.workloadSpec = spec
 	a.mu.Unlock()
 
+	a.boot.mark("workload-started")
+
 	go func() {
 		err := cmd.Wait()
 		done <- err
 		close(done)
 		if err != nil {
 			a.log.Printf("workload process exited with error: %v", err)
+			go a.pushReadiness(readinessStatusUnhealthy)
 		} else {
 			a.log.Printf("workload process exited")
 		}
@@ -984,6 +990,8 @@ func (a *App) startWorkload() error {
 		return fmt.Errorf("workload health check failed: %w", err)
 	}
 
+	a.boot.mark("health-passed")
+	go a.pushReadiness(readinessStatusReady)
 	a.log.Printf("workload process started (pid=%d)", cmd.Process.Pid)
 	return nil
 }
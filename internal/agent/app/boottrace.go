@@ -0,0 +1,133 @@
+// Copyright (c) 2025 HYPR. PTE. LTD.
+//
+// Business Source License 1.1
+// See LICENSE file in the project root for details.
+
+package app
+
+import (
+	"fmt"
+	"net/http"
+	"os"
+	"strconv"
+	"strings"
+	"sync"
+)
+
+const (
+	// bootMarksPath is where the C init and kestrel append boot phase
+	// marks. It lives on the /run tmpfs, so the timeline resets with
+	// every boot.
+	bootMarksPath = "/run/volant-boot-marks"
+	// bootMarksEnvKey carries the marks across the switch_root exec in
+	// rootfs mode, where the initramfs /run (and the file on it) is
+	// discarded before stage 2 starts.
+	bootMarksEnvKey = "volant_BOOT_MARKS"
+)
+
+// BootMark is a single boot phase with the CLOCK_MONOTONIC time at
+// which it completed, in microseconds since kernel start. The C init
+// and kestrel stamp the same clock, so marks from both line up on one
+// timeline.
+type BootMark struct {
+	Phase       string `json:"phase"`
+	MonotonicUS int64  `json:"monotonic_us"`
+}
+
+type bootTimeline struct {
+	mu    sync.Mutex
+	marks []BootMark
+}
+
+// newBootTimeline recovers any marks recorded before this process
+// started: from the pivot handoff environment first, then from the
+// marks file. Both may legitimately be absent (kestrel booted as PID 1
+// without the C init, or a restart within an established boot).
+func newBootTimeline() *bootTimeline {
+	t := &bootTimeline{}
+	if carried := os.Getenv(bootMarksEnvKey); carried != "" {
+		os.Unsetenv(bootMarksEnvKey)
+		t.marks = parseBootMarks(carried)
+		t.rewriteFile()
+		return t
+	}
+	if data, err := os.ReadFile(bootMarksPath); err == nil {
+		t.marks = parseBootMarks(string(data))
+	}
+	return t
+}
+
+func parseBootMarks(data string) []BootMark {
+	var marks []BootMark
+	for _, line := range strings.Split(data, "\n") {
+		fields := strings.Fields(line)
+		if len(fields) != 2 {
+			continue
+		}
+		us, err := strconv.ParseInt(fields[1], 10, 64)
+		if err != nil {
+			continue
+		}
+		marks = append(marks, BootMark{Phase: fields[0], MonotonicUS: us})
+	}
+	return marks
+}
+
+// mark records a phase the first time it is reached; later occurrences
+// (workload restarts, manifest refreshes) do not belong to the boot
+// timeline and are ignored.
+func (t *bootTimeline) mark(phase string) {
+	if t == nil {
+		return
+	}
+	t.mu.Lock()
+	defer t.mu.Unlock()
+	for _, m := range t.marks {
+		if m.Phase == phase {
+			return
+		}
+	}
+	m := BootMark{Phase: phase, MonotonicUS: monotonicMicros()}
+	t.marks = append(t.marks, m)
+	if file, err := os.OpenFile(bootMarksPath, os.O_CREATE|os.O_WRONLY|os.O_APPEND, 0o644); err == nil {
+		fmt.Fprintf(file, "%s %d\n", m.Phase, m.MonotonicUS)
+		file.Close()
+	}
+}
+
+func (t *bootTimeline) snapshot() []BootMark {
+	if t == nil {
+		return nil
+	}
+	t.mu.Lock()
+	defer t.mu.Unlock()
+	out := make([]BootMark, len(t.marks))
+	copy(out, t.marks)
+	return out
+}
+
+// rewriteFile replaces the marks file with the in-memory timeline,
+// re-seeding /run after a pivot handed the marks over via environment.
+func (t *bootTimeline) rewriteFile() {
+	var b strings.Builder
+	for _, m := range t.marks {
+		fmt.Fprintf(&b, "%s %d\n", m.Phase, m.MonotonicUS)
+	}
+	_ = os.WriteFile(bootMarksPath, []byte(b.String()), 0o644)
+}
+
+// stashBootMarks packs the marks file into the handoff environment so
+// the timeline survives the switch_root exec. Called from the stage 1
+// pivot path just before exec.
+func stashBootMarks() {
+	data, err := os.ReadFile(bootMarksPath)
+	if err != nil || len(data) == 0 {
+		return
+	}
+	os.Setenv(bootMarksEnvKey, string(data))
+}
+
+// handleBootTimeline serves the assembled boot timeline for this VM.
+func (a *App) handleBootTimeline(w http.ResponseWriter, r *http.Request) {
+	respondJSON(w, http.StatusOK, map[string]any{"marks": a.boot.snapshot()})
+}
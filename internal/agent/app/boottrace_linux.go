@@ -0,0 +1,21 @@
+// Copyright (c) 2025 HYPR. PTE. LTD.
+//
+// Business Source License 1.1
+// See LICENSE file in the project root for details.
+
+//go:build linux
+
+package app
+
+import "golang.org/x/sys/unix"
+
+// monotonicMicros returns CLOCK_MONOTONIC in microseconds — the same
+// clock the C init stamps, so both halves of the boot timeline share
+// an origin.
+func monotonicMicros() int64 {
+	var ts unix.Timespec
+	if err := unix.ClockGettime(unix.CLOCK_MONOTONIC, &ts); err != nil {
+		return 0
+	}
+	return ts.Sec*1000000 + ts.Nsec/1000
+}
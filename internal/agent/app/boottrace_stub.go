@@ -0,0 +1,19 @@
+// Copyright (c) 2025 HYPR. PTE. LTD.
+//
+// Business Source License 1.1
+// See LICENSE file in the project root for details.
+
+//go:build !linux
+
+package app
+
+import "time"
+
+var processStart = time.Now()
+
+// monotonicMicros approximates a boot-relative clock on non-Linux
+// platforms to allow local builds on macOS/Windows. The real
+// implementation lives in boottrace_linux.go.
+func monotonicMicros() int64 {
+	return time.Since(processStart).Microseconds()
+}
@@ -0,0 +1,47 @@
+// Copyright (c) 2025 HYPR. PTE. LTD.
+//
+// Business Source License 1.1
+// See LICENSE file in the project root for details.
+
+package app
+
+import (
+	"encoding/json"
+	"time"
+
+	"github.com/mdlayher/vsock"
+
+	"github.com/volantvm/volant/internal/pluginspec"
+)
+
+const (
+	readinessStatusReady     = "ready"
+	readinessStatusUnhealthy = "unhealthy"
+)
+
+// readinessNotification is the payload kestrel pushes to the host when
+// the workload's health state changes. The host identifies the VM by the
+// connection's vsock context ID, so no name travels in the payload.
+type readinessNotification struct {
+	Status    string    `json:"status"`
+	Timestamp time.Time `json:"timestamp"`
+}
+
+// pushReadiness notifies volantd of a workload health transition over
+// the dedicated vsock notification port. Push is best-effort: if vsock
+// is unavailable (non-VM environment, listener not running) the host
+// falls back to its usual polling, so failures are logged and dropped.
+func (a *App) pushReadiness(status string) {
+	conn, err := vsock.Dial(vsock.Host, pluginspec.ReadinessVsockPort, nil)
+	if err != nil {
+		a.log.Printf("readiness push unavailable: %v", err)
+		return
+	}
+	defer conn.Close()
+
+	_ = conn.SetDeadline(time.Now().Add(3 * time.Second))
+	payload := readinessNotification{Status: status, Timestamp: time.Now().UTC()}
+	if err := json.NewEncoder(conn).Encode(payload); err != nil {
+		a.log.Printf("readiness push failed: %v", err)
+	}
+}
@@ -86,6 +86,7 @@ func (a *App) bootstrapPID1Inner() error {
 			return fmt.Errorf("pid1 bootstrap error: copy self failed: %w", err)
 		}
 		a.log.Printf("Handing off to switch_root to pivot and re-execute for Stage 2 (rootfs mode)...")
+		stashBootMarks()
 		err := syscall.Exec("/bin/busybox", []string{"/bin/busybox", "switch_root", rootMountPoint, "/usr/local/bin/kestrel", "stage2"}, os.Environ())
 		if err != nil {
 			return fmt.Errorf("switch_root exec failed: %w", err)
@@ -111,6 +112,7 @@ func (a *App) bootstrapPID1Inner() error {
 			return fmt.Errorf("pid1 bootstrap error: copy self failed: %w", err)
 		}
 		a.log.Printf("Handing off to switch_root to pivot and re-execute for Stage 2 (auto mode)...")
+		stashBootMarks()
 		err := syscall.Exec("/bin/busybox", []string{"/bin/busybox", "switch_root", rootMountPoint, "/usr/local/bin/kestrel", "stage2"}, os.Environ())
 		if err != nil {
 			return fmt.Errorf("switch_root exec failed: %w", err)
@@ -185,7 +187,7 @@ func resolveRootfsDevice() string {
 	if value := cmdlineValue(pluginspec.RootFSDeviceKey); value != "" {
 		return value
 	}
-	for _, candidate := range []string{"vda", "vdb", "sda", "sdb"} {
+	for _, candidate := range []string{"vda", "vdb", "sda", "sdb", "pmem0"} {
 		if _, err := os.Stat("/dev/" + candidate); err == nil {
 			return candidate
 		}
@@ -193,6 +195,14 @@ func resolveRootfsDevice() string {
 	return ""
 }
 
+func resolveRootfsMode() string {
+	mode := strings.ToLower(strings.TrimSpace(cmdlineValue(pluginspec.RootFSModeKey)))
+	if mode == "overlay" {
+		return mode
+	}
+	return "direct"
+}
+
 func resolveRootfsFSType() string {
 	if value := cmdlineValue(pluginspec.RootFSFSTypeKey); value != "" {
 		return value
@@ -242,6 +252,9 @@ func waitForDevice(path string, timeout time.Duration) error {
 }
 
 func mountRootfs(device, fsType string) error {
+	if resolveRootfsMode() == "overlay" {
+		return mountRootfsOverlay(device, fsType)
+	}
 	if err := os.MkdirAll(rootMountPoint, 0o755); err != nil {
 		return err
 	}
@@ -251,6 +264,39 @@ func mountRootfs(device, fsType string) error {
 	return nil
 }
 
+// mountRootfsOverlay mounts the base image read-only (it is shared
+// across every replica on the host) and stacks a tmpfs-backed overlay
+// on top so the guest still sees a writable root.
+func mountRootfsOverlay(device, fsType string) error {
+	const (
+		baseMountPoint    = "/mnt/volant-base"
+		overlayMountPoint = "/mnt/volant-overlay"
+	)
+	for _, dir := range []string{baseMountPoint, overlayMountPoint, rootMountPoint} {
+		if err := os.MkdirAll(dir, 0o755); err != nil {
+			return err
+		}
+	}
+	if err := unix.Mount(device, baseMountPoint, fsType, unix.MS_RDONLY|unix.MS_RELATIME, ""); err != nil {
+		return fmt.Errorf("mount base rootfs %s on %s: %w", device, baseMountPoint, err)
+	}
+	if err := unix.Mount("tmpfs", overlayMountPoint, "tmpfs", 0, ""); err != nil {
+		return fmt.Errorf("mount overlay tmpfs on %s: %w", overlayMountPoint, err)
+	}
+	upperDir := filepath.Join(overlayMountPoint, "upper")
+	workDir := filepath.Join(overlayMountPoint, "work")
+	for _, dir := range []string{upperDir, workDir} {
+		if err := os.MkdirAll(dir, 0o755); err != nil {
+			return err
+		}
+	}
+	options := fmt.Sprintf("lowerdir=%s,upperdir=%s,workdir=%s", baseMountPoint, upperDir, workDir)
+	if err := unix.Mount("overlay", rootMountPoint, "overlay", 0, options); err != nil {
+		return fmt.Errorf("mount overlay root on %s: %w", rootMountPoint, err)
+	}
+	return nil
+}
+
 func copySelfToRoot() error {
 	self, err := os.Executable()
 	if err != nil {
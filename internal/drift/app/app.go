@@ -12,14 +12,18 @@ import (
 
 // Daemon coordinates HTTP serving and graceful shutdown for Drift.
 type Daemon struct {
-	cfg    config.Config
-	logger *slog.Logger
-	http   *http.Server
+	cfg     config.Config
+	logger  *slog.Logger
+	http    *http.Server
+	metrics *http.Server
 }
 
 // New constructs a Daemon with the provided configuration and handler.
-func New(cfg config.Config, logger *slog.Logger, handler http.Handler) *Daemon {
-	return &Daemon{
+// A non-nil metrics handler is served on the metrics listen address
+// when it differs from the API address; otherwise the API handler is
+// expected to expose the scrape path itself.
+func New(cfg config.Config, logger *slog.Logger, handler http.Handler, metrics http.Handler) *Daemon {
+	d := &Daemon{
 		cfg:    cfg,
 		logger: logger,
 		http: &http.Server{
@@ -27,23 +31,40 @@ func New(cfg config.Config, logger *slog.Logger, handler http.Handler) *Daemon {
 			Handler: handler,
 		},
 	}
+	if metrics != nil && cfg.MetricsListen != cfg.HTTPListen {
+		d.metrics = &http.Server{
+			Addr:    cfg.MetricsListen,
+			Handler: metrics,
+		}
+	}
+	return d
 }
 
-// Run starts the HTTP server and blocks until the context is canceled.
+// Run starts the HTTP servers and blocks until the context is canceled.
 func (d *Daemon) Run(ctx context.Context) error {
-	serverErr := make(chan error, 1)
+	serverErr := make(chan error, 2)
 	go func() {
 		d.logger.Info("http server starting", "addr", d.cfg.HTTPListen)
 		if err := d.http.ListenAndServe(); err != nil && !errors.Is(err, http.ErrServerClosed) {
 			serverErr <- err
 		}
-		close(serverErr)
 	}()
+	if d.metrics != nil {
+		go func() {
+			d.logger.Info("metrics server starting", "addr", d.cfg.MetricsListen)
+			if err := d.metrics.ListenAndServe(); err != nil && !errors.Is(err, http.ErrServerClosed) {
+				serverErr <- err
+			}
+		}()
+	}
 
 	select {
 	case <-ctx.Done():
 		shutdownCtx, cancel := context.WithTimeout(context.Background(), 10*time.Second)
 		defer cancel()
+		if d.metrics != nil {
+			_ = d.metrics.Shutdown(shutdownCtx)
+		}
 		if err := d.http.Shutdown(shutdownCtx); err != nil {
 			return err
 		}
@@ -10,16 +10,28 @@
 #include <bpf/bpf_endian.h>
 #include <bpf/bpf_helpers.h>
 
+#ifndef AF_INET
+#define AF_INET 2
+#endif
+
+#define DRIFT_MAX_BACKENDS 64
+
 struct portmap_key {
 	__u8 proto;
 	__u8 pad;
 	__be16 port;
 };
 
-struct portmap_value {
+struct portmap_backend {
 	__be32 dst_ip;
 	__be16 dst_port;
-	__u16 pad;
+	__u16 weight;
+};
+
+struct portmap_value {
+	__u32 backend_count;
+	__u32 total_weight;
+	struct portmap_backend backends[DRIFT_MAX_BACKENDS];
 };
 
 struct {
@@ -29,26 +41,160 @@ struct {
 	__type(value, struct portmap_value);
 } portmap SEC(".maps");
 
+/*
+ * Flow tuple as seen after the forward (DNAT) rewrite: src is the
+ * remote client, dst is the backend. The value remembers the original
+ * host-facing destination so egress can undo the rewrite without
+ * touching netfilter conntrack.
+ */
+struct ct_key {
+	__be32 src_ip;
+	__be32 dst_ip;
+	__be16 src_port;
+	__be16 dst_port;
+	__u8 proto;
+	__u8 pad[3];
+};
+
+struct ct_value {
+	__be32 orig_ip;
+	__be16 orig_port;
+	__u16 pad;
+};
+
+struct {
+	__uint(type, BPF_MAP_TYPE_LRU_HASH);
+	__uint(max_entries, 65536);
+	__type(key, struct ct_key);
+	__type(value, struct ct_value);
+} conntrack SEC(".maps");
+
+struct route_stats {
+	__u64 packets;
+	__u64 bytes;
+};
+
+struct {
+	__uint(type, BPF_MAP_TYPE_PERCPU_HASH);
+	__uint(max_entries, 4096);
+	__type(key, struct portmap_key);
+	__type(value, struct route_stats);
+} route_counters SEC(".maps");
+
+enum {
+	DRIFT_STAT_LOOKUP_MISS = 0,
+	DRIFT_STAT_REWRITE_ERR,
+	DRIFT_STAT_MAX,
+};
+
+struct {
+	__uint(type, BPF_MAP_TYPE_PERCPU_ARRAY);
+	__uint(max_entries, DRIFT_STAT_MAX);
+	__type(key, __u32);
+	__type(value, __u64);
+} global_counters SEC(".maps");
+
+static __always_inline void count_route(const struct portmap_key *key, __u64 bytes)
+{
+	struct route_stats *stats = bpf_map_lookup_elem(&route_counters, key);
+
+	if (stats) {
+		stats->packets++;
+		stats->bytes += bytes;
+		return;
+	}
+
+	struct route_stats fresh = {
+		.packets = 1,
+		.bytes = bytes,
+	};
+	bpf_map_update_elem(&route_counters, key, &fresh, BPF_NOEXIST);
+}
+
+static __always_inline void count_global(__u32 idx)
+{
+	__u64 *value = bpf_map_lookup_elem(&global_counters, &idx);
+
+	if (value)
+		(*value)++;
+}
+
+/*
+ * Weighted backend pick, keyed on the flow so every packet of a
+ * connection lands on the same replica. The hash deliberately excludes
+ * the (rewritten) destination address.
+ */
+static __always_inline __u32 flow_hash(__be32 saddr, __be16 sport, __be16 dport, __u8 proto)
+{
+	__u32 h = saddr;
+
+	h = h * 31 + (((__u32)sport << 16) | dport);
+	h = h * 31 + proto;
+	h ^= h >> 16;
+
+	return h;
+}
+
+static __always_inline struct portmap_backend *pick_backend(struct portmap_value *value, __u32 hash)
+{
+	__u32 count = value->backend_count;
+	__u32 total = value->total_weight;
+
+	if (count == 0 || count > DRIFT_MAX_BACKENDS || total == 0)
+		return 0;
+
+	__u32 point = hash % total;
+
+	for (int i = 0; i < DRIFT_MAX_BACKENDS; i++) {
+		if (i >= count)
+			break;
+		if (point < value->backends[i].weight)
+			return &value->backends[i];
+		point -= value->backends[i].weight;
+	}
+
+	return &value->backends[0];
+}
+
+static __always_inline void ct_record(__u8 proto, __be32 src_ip, __be16 src_port,
+				      __be32 orig_ip, __be16 orig_port,
+				      __be32 new_ip, __be16 new_port)
+{
+	struct ct_key key = {
+		.src_ip = src_ip,
+		.dst_ip = new_ip,
+		.src_port = src_port,
+		.dst_port = new_port,
+		.proto = proto,
+	};
+	struct ct_value value = {
+		.orig_ip = orig_ip,
+		.orig_port = orig_port,
+	};
+
+	bpf_map_update_elem(&conntrack, &key, &value, BPF_ANY);
+}
+
 static __always_inline int rewrite_tcp(struct __sk_buff *skb, struct iphdr *iph, struct tcphdr *tcph, __be32 new_ip, __be16 new_port, __u32 l3_off, __u32 l4_off)
 {
 	__be16 old_port = tcph->dest;
 	__be32 old_ip = iph->daddr;
 
 	if (bpf_l4_csum_replace(skb, l4_off + offsetof(struct tcphdr, check), old_port, new_port, sizeof(new_port)))
-		return TC_ACT_OK;
+		return -1;
 
 	if (bpf_l4_csum_replace(skb, l4_off + offsetof(struct tcphdr, check), old_ip, new_ip, sizeof(new_ip) | BPF_F_PSEUDO_HDR))
-		return TC_ACT_OK;
+		return -1;
 
 	if (bpf_l3_csum_replace(skb, l3_off + offsetof(struct iphdr, check), old_ip, new_ip, sizeof(new_ip)))
-		return TC_ACT_OK;
+		return -1;
 
 	if (bpf_skb_store_bytes(skb, l4_off + offsetof(struct tcphdr, dest), &new_port, sizeof(new_port), 0))
-		return TC_ACT_OK;
+		return -1;
 	if (bpf_skb_store_bytes(skb, l3_off + offsetof(struct iphdr, daddr), &new_ip, sizeof(new_ip), 0))
-		return TC_ACT_OK;
+		return -1;
 
-	return TC_ACT_OK;
+	return 0;
 }
 
 static __always_inline int rewrite_udp(struct __sk_buff *skb, struct iphdr *iph, struct udphdr *udph, __be32 new_ip, __be16 new_port, __u32 l3_off, __u32 l4_off)
@@ -58,20 +204,152 @@ static __always_inline int rewrite_udp(struct __sk_buff *skb, struct iphdr *iph,
 
 	if (udph->check) {
 		if (bpf_l4_csum_replace(skb, l4_off + offsetof(struct udphdr, check), old_port, new_port, sizeof(new_port)))
-			return TC_ACT_OK;
+			return -1;
 		if (bpf_l4_csum_replace(skb, l4_off + offsetof(struct udphdr, check), old_ip, new_ip, sizeof(new_ip) | BPF_F_PSEUDO_HDR))
-			return TC_ACT_OK;
+			return -1;
 	}
 
 	if (bpf_l3_csum_replace(skb, l3_off + offsetof(struct iphdr, check), old_ip, new_ip, sizeof(new_ip)))
-		return TC_ACT_OK;
+		return -1;
 
 	if (bpf_skb_store_bytes(skb, l4_off + offsetof(struct udphdr, dest), &new_port, sizeof(new_port), 0))
-		return TC_ACT_OK;
+		return -1;
 	if (bpf_skb_store_bytes(skb, l3_off + offsetof(struct iphdr, daddr), &new_ip, sizeof(new_ip), 0))
-		return TC_ACT_OK;
+		return -1;
 
-	return TC_ACT_OK;
+	return 0;
+}
+
+/*
+ * Incremental checksum update per RFC 1624 (HC' = ~(~HC + ~m + m')).
+ * Works for both 16-bit and 32-bit field replacements: a zero-extended
+ * 16-bit value contributes an extra 0xffff word, which is the additive
+ * identity in one's-complement arithmetic. All operands must be in the
+ * same byte order as the checksum field itself — pass raw __be16/__be32
+ * values, never bpf_ntohs/bpf_ntohl conversions.
+ */
+static __always_inline __u16 csum_replace(__u16 check, __u32 old, __u32 new)
+{
+	__u32 sum = (__u16)~check;
+
+	sum += (~old >> 16) & 0xffff;
+	sum += ~old & 0xffff;
+	sum += (new >> 16) & 0xffff;
+	sum += new & 0xffff;
+	sum = (sum & 0xffff) + (sum >> 16);
+	sum = (sum & 0xffff) + (sum >> 16);
+
+	return ~sum;
+}
+
+/*
+ * XDP twin of drift_l4_ingress. Shares the portmap map and performs the
+ * same DNAT rewrite before the kernel allocates an skb; on NICs with
+ * native XDP support this runs in the driver's poll loop. After the
+ * rewrite the frame is handed to the FIB: if the kernel already knows
+ * the next hop we forward straight from the driver, otherwise we fall
+ * back to XDP_PASS and let the stack route it.
+ */
+SEC("xdp")
+int drift_l4_xdp(struct xdp_md *ctx)
+{
+	void *data = (void *)(long)ctx->data;
+	void *data_end = (void *)(long)ctx->data_end;
+
+	struct ethhdr *eth = data;
+	if ((void *)(eth + 1) > data_end)
+		return XDP_PASS;
+
+	if (eth->h_proto != bpf_htons(ETH_P_IP))
+		return XDP_PASS;
+
+	struct iphdr *iph = (struct iphdr *)(eth + 1);
+	if ((void *)(iph + 1) > data_end)
+		return XDP_PASS;
+
+	if (iph->ihl < 5)
+		return XDP_PASS;
+
+	__u8 proto = iph->protocol;
+	void *l4 = (void *)iph + iph->ihl * 4;
+
+	struct portmap_value *value;
+	struct portmap_backend *backend;
+	__be32 old_ip = iph->daddr;
+
+	if (proto == IPPROTO_TCP) {
+		struct tcphdr *tcph = l4;
+		if ((void *)(tcph + 1) > data_end)
+			return XDP_PASS;
+
+		struct portmap_key key = {
+			.proto = proto,
+			.port = tcph->dest,
+		};
+		value = bpf_map_lookup_elem(&portmap, &key);
+		if (!value) {
+			count_global(DRIFT_STAT_LOOKUP_MISS);
+			return XDP_PASS;
+		}
+		backend = pick_backend(value, flow_hash(iph->saddr, tcph->source, tcph->dest, proto));
+		if (!backend)
+			return XDP_PASS;
+
+		count_route(&key, (__u64)(data_end - data));
+		ct_record(proto, iph->saddr, tcph->source, old_ip, tcph->dest, backend->dst_ip, backend->dst_port);
+		tcph->check = csum_replace(tcph->check, tcph->dest, backend->dst_port);
+		tcph->check = csum_replace(tcph->check, old_ip, backend->dst_ip);
+		tcph->dest = backend->dst_port;
+	} else if (proto == IPPROTO_UDP) {
+		struct udphdr *udph = l4;
+		if ((void *)(udph + 1) > data_end)
+			return XDP_PASS;
+
+		struct portmap_key key = {
+			.proto = proto,
+			.port = udph->dest,
+		};
+		value = bpf_map_lookup_elem(&portmap, &key);
+		if (!value) {
+			count_global(DRIFT_STAT_LOOKUP_MISS);
+			return XDP_PASS;
+		}
+		backend = pick_backend(value, flow_hash(iph->saddr, udph->source, udph->dest, proto));
+		if (!backend)
+			return XDP_PASS;
+
+		count_route(&key, (__u64)(data_end - data));
+		ct_record(proto, iph->saddr, udph->source, old_ip, udph->dest, backend->dst_ip, backend->dst_port);
+		if (udph->check) {
+			udph->check = csum_replace(udph->check, udph->dest, backend->dst_port);
+			udph->check = csum_replace(udph->check, old_ip, backend->dst_ip);
+			if (!udph->check)
+				udph->check = 0xffff;
+		}
+		udph->dest = backend->dst_port;
+	} else {
+		return XDP_PASS;
+	}
+
+	iph->check = csum_replace(iph->check, old_ip, backend->dst_ip);
+	iph->daddr = backend->dst_ip;
+
+	struct bpf_fib_lookup fib = {
+		.family = AF_INET,
+		.l4_protocol = proto,
+		.tot_len = bpf_ntohs(iph->tot_len),
+		.ifindex = ctx->ingress_ifindex,
+		.ipv4_src = iph->saddr,
+		.ipv4_dst = iph->daddr,
+	};
+
+	int rc = bpf_fib_lookup(ctx, &fib, sizeof(fib), 0);
+	if (rc != BPF_FIB_LKUP_RET_SUCCESS)
+		return XDP_PASS;
+
+	__builtin_memcpy(eth->h_source, fib.smac, ETH_ALEN);
+	__builtin_memcpy(eth->h_dest, fib.dmac, ETH_ALEN);
+	return bpf_redirect(fib.ifindex, 0);
 }
 
 SEC("tc")
@@ -112,9 +390,18 @@ int drift_l4_ingress(struct __sk_buff *skb)
 			.port = tcph->dest,
 		};
 		struct portmap_value *value = bpf_map_lookup_elem(&portmap, &key);
-		if (!value)
+		if (!value) {
+			count_global(DRIFT_STAT_LOOKUP_MISS);
+			return TC_ACT_OK;
+		}
+		struct portmap_backend *backend = pick_backend(value, flow_hash(iph->saddr, tcph->source, tcph->dest, proto));
+		if (!backend)
 			return TC_ACT_OK;
-		return rewrite_tcp(skb, iph, tcph, value->dst_ip, value->dst_port, l3_off, l4_off);
+		count_route(&key, skb->len);
+		ct_record(proto, iph->saddr, tcph->source, iph->daddr, tcph->dest, backend->dst_ip, backend->dst_port);
+		if (rewrite_tcp(skb, iph, tcph, backend->dst_ip, backend->dst_port, l3_off, l4_off))
+			count_global(DRIFT_STAT_REWRITE_ERR);
+		return TC_ACT_OK;
 	}
 
 	if (proto == IPPROTO_UDP) {
@@ -126,9 +413,139 @@ int drift_l4_ingress(struct __sk_buff *skb)
 			.port = udph->dest,
 		};
 		struct portmap_value *value = bpf_map_lookup_elem(&portmap, &key);
+		if (!value) {
+			count_global(DRIFT_STAT_LOOKUP_MISS);
+			return TC_ACT_OK;
+		}
+		struct portmap_backend *backend = pick_backend(value, flow_hash(iph->saddr, udph->source, udph->dest, proto));
+		if (!backend)
+			return TC_ACT_OK;
+		count_route(&key, skb->len);
+		ct_record(proto, iph->saddr, udph->source, iph->daddr, udph->dest, backend->dst_ip, backend->dst_port);
+		if (rewrite_udp(skb, iph, udph, backend->dst_ip, backend->dst_port, l3_off, l4_off))
+			count_global(DRIFT_STAT_REWRITE_ERR);
+		return TC_ACT_OK;
+	}
+
+	return TC_ACT_OK;
+}
+
+static __always_inline int unrewrite_tcp(struct __sk_buff *skb, struct iphdr *iph, struct tcphdr *tcph, __be32 orig_ip, __be16 orig_port, __u32 l3_off, __u32 l4_off)
+{
+	__be16 old_port = tcph->source;
+	__be32 old_ip = iph->saddr;
+
+	if (bpf_l4_csum_replace(skb, l4_off + offsetof(struct tcphdr, check), old_port, orig_port, sizeof(orig_port)))
+		return -1;
+
+	if (bpf_l4_csum_replace(skb, l4_off + offsetof(struct tcphdr, check), old_ip, orig_ip, sizeof(orig_ip) | BPF_F_PSEUDO_HDR))
+		return -1;
+
+	if (bpf_l3_csum_replace(skb, l3_off + offsetof(struct iphdr, check), old_ip, orig_ip, sizeof(orig_ip)))
+		return -1;
+
+	if (bpf_skb_store_bytes(skb, l4_off + offsetof(struct tcphdr, source), &orig_port, sizeof(orig_port), 0))
+		return -1;
+	if (bpf_skb_store_bytes(skb, l3_off + offsetof(struct iphdr, saddr), &orig_ip, sizeof(orig_ip), 0))
+		return -1;
+
+	return 0;
+}
+
+static __always_inline int unrewrite_udp(struct __sk_buff *skb, struct iphdr *iph, struct udphdr *udph, __be32 orig_ip, __be16 orig_port, __u32 l3_off, __u32 l4_off)
+{
+	__be16 old_port = udph->source;
+	__be32 old_ip = iph->saddr;
+
+	if (udph->check) {
+		if (bpf_l4_csum_replace(skb, l4_off + offsetof(struct udphdr, check), old_port, orig_port, sizeof(orig_port)))
+			return -1;
+		if (bpf_l4_csum_replace(skb, l4_off + offsetof(struct udphdr, check), old_ip, orig_ip, sizeof(orig_ip) | BPF_F_PSEUDO_HDR))
+			return -1;
+	}
+
+	if (bpf_l3_csum_replace(skb, l3_off + offsetof(struct iphdr, check), old_ip, orig_ip, sizeof(orig_ip)))
+		return -1;
+
+	if (bpf_skb_store_bytes(skb, l4_off + offsetof(struct udphdr, source), &orig_port, sizeof(orig_port), 0))
+		return -1;
+	if (bpf_skb_store_bytes(skb, l3_off + offsetof(struct iphdr, saddr), &orig_ip, sizeof(orig_ip), 0))
+		return -1;
+
+	return 0;
+}
+
+/*
+ * Reverse-NAT for backend-to-client traffic. Looks up the forward flow
+ * tuple recorded at ingress and restores the original host-facing
+ * source ip/port, so established flows never hit netfilter conntrack
+ * on the return path either.
+ */
+SEC("tc")
+int drift_l4_egress(struct __sk_buff *skb)
+{
+	void *data = (void *)(long)skb->data;
+	void *data_end = (void *)(long)skb->data_end;
+
+	struct ethhdr *eth = data;
+	if ((void *)(eth + 1) > data_end)
+		return TC_ACT_OK;
+
+	if (eth->h_proto != bpf_htons(ETH_P_IP))
+		return TC_ACT_OK;
+
+	struct iphdr *iph = (struct iphdr *)(eth + 1);
+	if ((void *)(iph + 1) > data_end)
+		return TC_ACT_OK;
+
+	if (iph->ihl < 5)
+		return TC_ACT_OK;
+
+	__u8 proto = iph->protocol;
+	__u32 ihl_bytes = iph->ihl * 4;
+	void *l4 = (void *)iph + ihl_bytes;
+	if (l4 + sizeof(__be16) > data_end)
+		return TC_ACT_OK;
+
+	__u32 l3_off = (void *)iph - data;
+	__u32 l4_off = (void *)l4 - data;
+
+	if (proto == IPPROTO_TCP) {
+		struct tcphdr *tcph = l4;
+		if ((void *)(tcph + 1) > data_end)
+			return TC_ACT_OK;
+		struct ct_key key = {
+			.src_ip = iph->daddr,
+			.dst_ip = iph->saddr,
+			.src_port = tcph->dest,
+			.dst_port = tcph->source,
+			.proto = proto,
+		};
+		struct ct_value *value = bpf_map_lookup_elem(&conntrack, &key);
 		if (!value)
 			return TC_ACT_OK;
-		return rewrite_udp(skb, iph, udph, value->dst_ip, value->dst_port, l3_off, l4_off);
+		if (unrewrite_tcp(skb, iph, tcph, value->orig_ip, value->orig_port, l3_off, l4_off))
+			count_global(DRIFT_STAT_REWRITE_ERR);
+		return TC_ACT_OK;
+	}
+
+	if (proto == IPPROTO_UDP) {
+		struct udphdr *udph = l4;
+		if ((void *)(udph + 1) > data_end)
+			return TC_ACT_OK;
+		struct ct_key key = {
+			.src_ip = iph->daddr,
+			.dst_ip = iph->saddr,
+			.src_port = udph->dest,
+			.dst_port = udph->source,
+			.proto = proto,
+		};
+		struct ct_value *value = bpf_map_lookup_elem(&conntrack, &key);
+		if (!value)
+			return TC_ACT_OK;
+		if (unrewrite_udp(skb, iph, udph, value->orig_ip, value->orig_port, l3_off, l4_off))
+			count_global(DRIFT_STAT_REWRITE_ERR);
+		return TC_ACT_OK;
 	}
 
 	return TC_ACT_OK;
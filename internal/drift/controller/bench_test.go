@@ -0,0 +1,72 @@
+package controller
+
+import (
+	"context"
+	"fmt"
+	"os"
+	"testing"
+
+	"github.com/volantvm/volant/internal/drift/dataplane"
+	"github.com/volantvm/volant/internal/drift/routes"
+)
+
+// benchDataplane accepts programming calls without touching BPF so the
+// benchmark isolates the controller and store route-programming path.
+type benchDataplane struct{}
+
+func (benchDataplane) ApplyBridge(context.Context, uint8, uint16, []dataplane.BridgeBackend) error {
+	return nil
+}
+func (benchDataplane) ApplyBridgeBatch(context.Context, []dataplane.BridgeRoute) error { return nil }
+func (benchDataplane) Remove(context.Context, uint8, uint16) error                     { return nil }
+func (benchDataplane) RemoveBatch(context.Context, []dataplane.BridgeRouteKey) error   { return nil }
+func (benchDataplane) Stats(context.Context) (dataplane.Stats, error) {
+	return dataplane.Stats{}, nil
+}
+func (benchDataplane) Close() error { return nil }
+
+// BenchmarkRouteUpsert measures route programming throughput through the
+// controller with dataplane cost excluded.
+func BenchmarkRouteUpsert(b *testing.B) {
+	benchRouteUpsert(b, benchDataplane{})
+}
+
+// BenchmarkRouteUpsertBPF runs the same loop against the real eBPF
+// dataplane. It needs root plus a compiled BPF object, so it is opt-in:
+// set DRIFT_BENCH_OBJ to the drift_l4.bpf.o path and DRIFT_BENCH_IFACE
+// to the attach interface.
+func BenchmarkRouteUpsertBPF(b *testing.B) {
+	obj := os.Getenv("DRIFT_BENCH_OBJ")
+	iface := os.Getenv("DRIFT_BENCH_IFACE")
+	if obj == "" || iface == "" {
+		b.Skip("set DRIFT_BENCH_OBJ and DRIFT_BENCH_IFACE to benchmark the eBPF dataplane")
+	}
+	dp, err := dataplane.New(dataplane.Options{ObjectPath: obj, Interface: iface})
+	if err != nil {
+		b.Skipf("dataplane unavailable: %v", err)
+	}
+	defer dp.Close()
+	benchRouteUpsert(b, dp)
+}
+
+func benchRouteUpsert(b *testing.B, dp dataplane.Interface) {
+	ctx := context.Background()
+	ctrl := New(routes.NewMemoryStore(), dp, nil)
+
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		route := routes.Route{
+			HostPort: uint16(1024 + i%40000),
+			Protocol: "tcp",
+			Backend: routes.Backend{
+				Type:   routes.BackendBridge,
+				IP:     fmt.Sprintf("10.0.%d.%d", i/250%250, i%250+1),
+				Port:   8080,
+				Weight: 1,
+			},
+		}
+		if _, err := ctrl.Upsert(ctx, route); err != nil {
+			b.Fatalf("upsert: %v", err)
+		}
+	}
+}
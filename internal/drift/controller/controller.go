@@ -6,6 +6,7 @@ import (
 	"fmt"
 	"net"
 	"strings"
+	"sync"
 
 	"github.com/volantvm/volant/internal/drift/dataplane"
 	"github.com/volantvm/volant/internal/drift/routes"
@@ -17,6 +18,9 @@ type Controller struct {
 	store routes.Store
 	dp    dataplane.Interface
 	vsock vsockproxy.Manager
+
+	syncMu     sync.Mutex
+	generation uint64
 }
 
 // New constructs a Controller.
@@ -40,6 +44,14 @@ func (c *Controller) List(ctx context.Context) ([]routes.Route, error) {
 	return c.store.List(ctx)
 }
 
+// Stats returns a snapshot of dataplane counters.
+func (c *Controller) Stats(ctx context.Context) (dataplane.Stats, error) {
+	if c.dp == nil {
+		return dataplane.Stats{}, RuntimeUnavailableError{Component: "bridge dataplane"}
+	}
+	return c.dp.Stats(ctx)
+}
+
 // Upsert validates, applies to dataplane, and persists the route.
 func (c *Controller) Upsert(ctx context.Context, route routes.Route) (routes.Route, error) {
 	normalized, err := normalize(route)
@@ -78,19 +90,75 @@ func (c *Controller) Delete(ctx context.Context, hostPort uint16, protocol strin
 	return c.store.Delete(ctx, hostPort, protocol)
 }
 
-// Restore replays persisted routes into runtime managers.
+// Sync applies a generation-stamped delta of route mutations. Replays
+// of an already-acked generation are no-ops, so the control plane can
+// retry a delta safely. The response always carries the daemon's
+// current generation: it echoes the request generation when the delta
+// was applied, and a higher value when the delta was discarded as a
+// replay — callers detecting the latter must resend above it.
+func (c *Controller) Sync(ctx context.Context, req routes.SyncRequest) (routes.SyncResponse, error) {
+	c.syncMu.Lock()
+	defer c.syncMu.Unlock()
+
+	if req.Generation != 0 && req.Generation <= c.generation {
+		return routes.SyncResponse{Generation: c.generation}, nil
+	}
+
+	for _, route := range req.Adds {
+		if _, err := c.Upsert(ctx, route); err != nil {
+			return routes.SyncResponse{Generation: c.generation}, err
+		}
+	}
+	for _, key := range req.Removes {
+		if err := c.Delete(ctx, key.HostPort, key.Protocol); err != nil && !errors.Is(err, routes.ErrNotFound) {
+			return routes.SyncResponse{Generation: c.generation}, err
+		}
+	}
+
+	if req.Generation != 0 {
+		c.generation = req.Generation
+	} else {
+		c.generation++
+	}
+	return routes.SyncResponse{Generation: c.generation}, nil
+}
+
+// Restore replays persisted routes into runtime managers. Bridge
+// routes are collected and programmed through one batched map update
+// so a large table does not blackhole traffic for the duration of
+// per-entry syscall round-trips.
 func (c *Controller) Restore(ctx context.Context) error {
 	items, err := c.store.List(ctx)
 	if err != nil {
 		return err
 	}
+
+	bridge := make([]dataplane.BridgeRoute, 0, len(items))
 	for _, route := range items {
-		if err := c.applyRuntime(ctx, route); err != nil {
-			var unavailable RuntimeUnavailableError
-			if errors.As(err, &unavailable) {
+		switch route.Backend.Type {
+		case routes.BackendBridge:
+			if c.dp == nil {
 				continue
 			}
-			return fmt.Errorf("restore route %d/%s: %w", route.HostPort, route.Protocol, err)
+			bridge = append(bridge, dataplane.BridgeRoute{
+				Proto:    protocolNumber(route.Protocol),
+				HostPort: route.HostPort,
+				Backends: bridgeBackends(route),
+			})
+		case routes.BackendVsock:
+			if err := c.applyRuntime(ctx, route); err != nil {
+				var unavailable RuntimeUnavailableError
+				if errors.As(err, &unavailable) {
+					continue
+				}
+				return fmt.Errorf("restore route %d/%s: %w", route.HostPort, route.Protocol, err)
+			}
+		}
+	}
+
+	if len(bridge) > 0 {
+		if err := c.dp.ApplyBridgeBatch(ctx, bridge); err != nil {
+			return fmt.Errorf("restore bridge routes: %w", err)
 		}
 	}
 	return nil
@@ -120,14 +188,31 @@ func normalize(route routes.Route) (routes.Route, error) {
 			return routes.Route{}, fmt.Errorf("backend.ip must be valid ipv4")
 		}
 		normalized.Backend.IP = parsed.String()
+		if len(route.Backends) > routes.MaxBackends {
+			return routes.Route{}, fmt.Errorf("backends list exceeds limit of %d", routes.MaxBackends)
+		}
+		normalized.Backends = append([]routes.Backend(nil), route.Backends...)
+		for i, backend := range route.Backends {
+			ip := strings.TrimSpace(backend.IP)
+			parsed := net.ParseIP(ip)
+			if parsed == nil || parsed.To4() == nil {
+				return routes.Route{}, fmt.Errorf("backends[%d].ip must be valid ipv4", i)
+			}
+			if backend.Port == 0 {
+				return routes.Route{}, fmt.Errorf("backends[%d].port must be > 0", i)
+			}
+			normalized.Backends[i].Type = routes.BackendBridge
+			normalized.Backends[i].IP = parsed.String()
+			if backend.Weight == 0 {
+				normalized.Backends[i].Weight = 1
+			}
+		}
 	case routes.BackendVsock:
 		if route.Backend.CID == 0 {
 			return routes.Route{}, fmt.Errorf("backend.cid must be > 0 for vsock routes")
 		}
-		if normalized.Protocol != "tcp" {
-			return routes.Route{}, fmt.Errorf("vsock routes require tcp protocol")
-		}
 		normalized.Backend.IP = ""
+		normalized.Backends = nil
 	default:
 		return routes.Route{}, fmt.Errorf("backend type %q not supported", route.Backend.Type)
 	}
@@ -155,14 +240,35 @@ func protocolNumber(proto string) uint8 {
 	}
 }
 
+// bridgeBackends flattens a route into the dataplane backend set,
+// falling back to the primary backend for single-target routes.
+func bridgeBackends(route routes.Route) []dataplane.BridgeBackend {
+	if len(route.Backends) == 0 {
+		return []dataplane.BridgeBackend{{
+			IP:     net.ParseIP(route.Backend.IP),
+			Port:   route.Backend.Port,
+			Weight: route.Backend.Weight,
+		}}
+	}
+	backends := make([]dataplane.BridgeBackend, 0, len(route.Backends))
+	for _, backend := range route.Backends {
+		backends = append(backends, dataplane.BridgeBackend{
+			IP:     net.ParseIP(backend.IP),
+			Port:   backend.Port,
+			Weight: backend.Weight,
+		})
+	}
+	return backends
+}
+
 func (c *Controller) applyRuntime(ctx context.Context, route routes.Route) error {
 	switch route.Backend.Type {
 	case routes.BackendBridge:
 		if c.dp == nil {
 			return RuntimeUnavailableError{Component: "bridge dataplane"}
 		}
-		dstIP := net.ParseIP(route.Backend.IP)
-		if err := c.dp.ApplyBridge(ctx, protocolNumber(route.Protocol), route.HostPort, dstIP, route.Backend.Port); err != nil {
+		backends := bridgeBackends(route)
+		if err := c.dp.ApplyBridge(ctx, protocolNumber(route.Protocol), route.HostPort, backends); err != nil {
 			return fmt.Errorf("apply bridge dataplane: %w", err)
 		}
 	case routes.BackendVsock:
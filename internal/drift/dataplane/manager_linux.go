@@ -13,19 +13,40 @@ import (
 
 	"github.com/cilium/ebpf"
 	"github.com/cilium/ebpf/link"
+
+	"github.com/volantvm/volant/internal/drift/routes"
 )
 
 type manager struct {
-	logger   *slog.Logger
-	program  *ebpf.Program
-	portmap  *ebpf.Map
-	link     link.Link
-	iface    string
-	mu       sync.Mutex
-	closed   bool
-	programs *ebpf.Collection
+	logger         *slog.Logger
+	program        *ebpf.Program
+	portmap        *ebpf.Map
+	routeCounters  *ebpf.Map
+	globalCounters *ebpf.Map
+	link           link.Link
+	egressLink     link.Link
+	iface          string
+	mode           string
+	mu             sync.Mutex
+	closed         bool
+	programs       *ebpf.Collection
 }
 
+// Indices into the global_counters per-CPU array in the BPF object.
+const (
+	statLookupMiss uint32 = iota
+	statRewriteErr
+)
+
+// Attachment modes in order of preference. XDP-native runs in the NIC
+// driver before skb allocation; XDP-generic and TC are progressively
+// slower fallbacks for hardware or kernels without native support.
+const (
+	attachModeXDPNative  = "xdp-native"
+	attachModeXDPGeneric = "xdp-generic"
+	attachModeTC         = "tc"
+)
+
 func newManager(opts Options) (Interface, error) {
 	if opts.Logger == nil {
 		opts.Logger = slog.Default()
@@ -65,36 +86,89 @@ func newManager(opts Options) (Interface, error) {
 		return nil, fmt.Errorf("dataplane: lookup interface %s: %w", opts.Interface, err)
 	}
 
-	l, err := link.AttachTCX(link.TCXOptions{
-		Program:   prog,
-		Interface: iface.Index,
-		Attach:    ebpf.AttachTCXIngress,
-	})
+	l, attached, mode, err := attach(coll, prog, iface.Index)
 	if err != nil {
 		coll.Close()
-		return nil, fmt.Errorf("dataplane: attach tcx: %w", err)
+		return nil, err
+	}
+
+	logger := opts.Logger.With("component", "dataplane")
+	logger.Info("dataplane attached", "interface", opts.Interface, "mode", mode)
+
+	// Reverse NAT for established flows. Egress is always a TC hook
+	// (XDP is receive-only); objects built before the conntrack map
+	// simply do not carry the program.
+	var egressLink link.Link
+	if egressProg, ok := coll.Programs["drift_l4_egress"]; ok {
+		egressLink, err = link.AttachTCX(link.TCXOptions{
+			Program:   egressProg,
+			Interface: iface.Index,
+			Attach:    ebpf.AttachTCXEgress,
+		})
+		if err != nil {
+			_ = l.Close()
+			coll.Close()
+			return nil, fmt.Errorf("dataplane: attach tcx egress: %w", err)
+		}
 	}
 
 	return &manager{
-		logger:   opts.Logger.With("component", "dataplane"),
-		program:  prog,
-		portmap:  portmap,
-		link:     l,
-		iface:    opts.Interface,
-		programs: coll,
+		logger:         logger,
+		program:        attached,
+		portmap:        portmap,
+		routeCounters:  coll.Maps["route_counters"],
+		globalCounters: coll.Maps["global_counters"],
+		link:           l,
+		egressLink:     egressLink,
+		iface:          opts.Interface,
+		mode:           mode,
+		programs:       coll,
 	}, nil
 }
 
-func (m *manager) ApplyBridge(_ context.Context, proto uint8, hostPort uint16, destIP net.IP, destPort uint16) error {
+// attach wires the fastest supported program onto the interface:
+// XDP in native (driver) mode, then XDP in generic mode, then the TC
+// classifier. Older BPF objects without the XDP program go straight
+// to TC.
+func attach(coll *ebpf.Collection, tcProg *ebpf.Program, ifindex int) (link.Link, *ebpf.Program, string, error) {
+	if xdpProg, ok := coll.Programs["drift_l4_xdp"]; ok {
+		if l, err := link.AttachXDP(link.XDPOptions{
+			Program:   xdpProg,
+			Interface: ifindex,
+			Flags:     link.XDPDriverMode,
+		}); err == nil {
+			return l, xdpProg, attachModeXDPNative, nil
+		}
+		if l, err := link.AttachXDP(link.XDPOptions{
+			Program:   xdpProg,
+			Interface: ifindex,
+			Flags:     link.XDPGenericMode,
+		}); err == nil {
+			return l, xdpProg, attachModeXDPGeneric, nil
+		}
+	}
+
+	l, err := link.AttachTCX(link.TCXOptions{
+		Program:   tcProg,
+		Interface: ifindex,
+		Attach:    ebpf.AttachTCXIngress,
+	})
+	if err != nil {
+		return nil, nil, "", fmt.Errorf("dataplane: attach tcx: %w", err)
+	}
+	return l, tcProg, attachModeTC, nil
+}
+
+func (m *manager) ApplyBridge(_ context.Context, proto uint8, hostPort uint16, backends []BridgeBackend) error {
 	m.mu.Lock()
 	defer m.mu.Unlock()
 	if m.closed {
 		return errors.New("dataplane: manager closed")
 	}
 
-	ip4 := destIP.To4()
-	if ip4 == nil {
-		return fmt.Errorf("dataplane: destination ip %s not ipv4", destIP)
+	value, err := buildPortmapValue(backends)
+	if err != nil {
+		return err
 	}
 
 	key := portmapKey{
@@ -102,16 +176,113 @@ func (m *manager) ApplyBridge(_ context.Context, proto uint8, hostPort uint16, d
 		Port:  htons(hostPort),
 	}
 
-	value := portmapValue{
-		DestIP:   binary.BigEndian.Uint32(ip4),
-		DestPort: htons(destPort),
-	}
-
 	if err := m.portmap.Put(&key, &value); err != nil {
 		return fmt.Errorf("dataplane: portmap update: %w", err)
 	}
 
-	m.logger.Info("route applied", "proto", protoName(proto), "host_port", hostPort, "dest_ip", destIP.String(), "dest_port", destPort)
+	m.logger.Info("route applied", "proto", protoName(proto), "host_port", hostPort, "backends", len(backends))
+	return nil
+}
+
+func buildPortmapValue(backends []BridgeBackend) (portmapValue, error) {
+	if len(backends) == 0 {
+		return portmapValue{}, fmt.Errorf("dataplane: at least one backend required")
+	}
+	if len(backends) > routes.MaxBackends {
+		return portmapValue{}, fmt.Errorf("dataplane: backend set size %d exceeds limit %d", len(backends), routes.MaxBackends)
+	}
+
+	value := portmapValue{BackendCount: uint32(len(backends))}
+	for i, backend := range backends {
+		ip4 := backend.IP.To4()
+		if ip4 == nil {
+			return portmapValue{}, fmt.Errorf("dataplane: destination ip %s not ipv4", backend.IP)
+		}
+		weight := backend.Weight
+		if weight == 0 {
+			weight = 1
+		}
+		value.Backends[i] = portmapBackend{
+			DestIP:   binary.BigEndian.Uint32(ip4),
+			DestPort: htons(backend.Port),
+			Weight:   weight,
+		}
+		value.TotalWeight += uint32(weight)
+	}
+	return value, nil
+}
+
+// ApplyBridgeBatch programs a set of routes in one BPF_MAP_UPDATE_BATCH
+// syscall, falling back to per-entry updates on kernels without batch
+// map operations.
+func (m *manager) ApplyBridgeBatch(_ context.Context, bridgeRoutes []BridgeRoute) error {
+	m.mu.Lock()
+	defer m.mu.Unlock()
+	if m.closed {
+		return errors.New("dataplane: manager closed")
+	}
+	if len(bridgeRoutes) == 0 {
+		return nil
+	}
+
+	keys := make([]portmapKey, 0, len(bridgeRoutes))
+	values := make([]portmapValue, 0, len(bridgeRoutes))
+	for _, route := range bridgeRoutes {
+		value, err := buildPortmapValue(route.Backends)
+		if err != nil {
+			return err
+		}
+		keys = append(keys, portmapKey{Proto: route.Proto, Port: htons(route.HostPort)})
+		values = append(values, value)
+	}
+
+	if _, err := m.portmap.BatchUpdate(keys, values, nil); err != nil {
+		if !errors.Is(err, ebpf.ErrNotSupported) {
+			return fmt.Errorf("dataplane: portmap batch update: %w", err)
+		}
+		for i := range keys {
+			if err := m.portmap.Put(&keys[i], &values[i]); err != nil {
+				return fmt.Errorf("dataplane: portmap update: %w", err)
+			}
+		}
+	}
+
+	m.logger.Info("routes applied", "count", len(keys))
+	return nil
+}
+
+// RemoveBatch deletes a set of routes in one BPF_MAP_DELETE_BATCH
+// syscall, with the same per-entry fallback as ApplyBridgeBatch.
+func (m *manager) RemoveBatch(_ context.Context, routeKeys []BridgeRouteKey) error {
+	m.mu.Lock()
+	defer m.mu.Unlock()
+	if m.closed {
+		return errors.New("dataplane: manager closed")
+	}
+	if len(routeKeys) == 0 {
+		return nil
+	}
+
+	keys := make([]portmapKey, 0, len(routeKeys))
+	for _, key := range routeKeys {
+		keys = append(keys, portmapKey{Proto: key.Proto, Port: htons(key.HostPort)})
+	}
+
+	if _, err := m.portmap.BatchDelete(keys, nil); err != nil {
+		if errors.Is(err, ebpf.ErrKeyNotExist) {
+			return nil
+		}
+		if !errors.Is(err, ebpf.ErrNotSupported) {
+			return fmt.Errorf("dataplane: portmap batch delete: %w", err)
+		}
+		for i := range keys {
+			if err := m.portmap.Delete(&keys[i]); err != nil && !errors.Is(err, ebpf.ErrKeyNotExist) {
+				return fmt.Errorf("dataplane: portmap delete: %w", err)
+			}
+		}
+	}
+
+	m.logger.Info("routes removed", "count", len(keys))
 	return nil
 }
 
@@ -135,6 +306,61 @@ func (m *manager) Remove(_ context.Context, proto uint8, hostPort uint16) error
 	return nil
 }
 
+// Stats sums the per-CPU counter maps into a snapshot. Maps are absent
+// when an older BPF object is loaded; the snapshot is then empty.
+func (m *manager) Stats(_ context.Context) (Stats, error) {
+	m.mu.Lock()
+	defer m.mu.Unlock()
+	if m.closed {
+		return Stats{}, errors.New("dataplane: manager closed")
+	}
+
+	var stats Stats
+	if m.routeCounters != nil {
+		var (
+			key    portmapKey
+			perCPU []routeStatsValue
+		)
+		iter := m.routeCounters.Iterate()
+		for iter.Next(&key, &perCPU) {
+			entry := RouteStats{
+				Protocol: protoName(key.Proto),
+				HostPort: htons(key.Port),
+			}
+			for _, v := range perCPU {
+				entry.Packets += v.Packets
+				entry.Bytes += v.Bytes
+			}
+			stats.Routes = append(stats.Routes, entry)
+		}
+		if err := iter.Err(); err != nil {
+			return Stats{}, fmt.Errorf("dataplane: iterate route counters: %w", err)
+		}
+	}
+	if m.globalCounters != nil {
+		var err error
+		if stats.LookupMisses, err = sumPerCPU(m.globalCounters, statLookupMiss); err != nil {
+			return Stats{}, err
+		}
+		if stats.RewriteErrors, err = sumPerCPU(m.globalCounters, statRewriteErr); err != nil {
+			return Stats{}, err
+		}
+	}
+	return stats, nil
+}
+
+func sumPerCPU(counters *ebpf.Map, index uint32) (uint64, error) {
+	var perCPU []uint64
+	if err := counters.Lookup(&index, &perCPU); err != nil {
+		return 0, fmt.Errorf("dataplane: read counter %d: %w", index, err)
+	}
+	var total uint64
+	for _, v := range perCPU {
+		total += v
+	}
+	return total, nil
+}
+
 func (m *manager) Close() error {
 	m.mu.Lock()
 	defer m.mu.Unlock()
@@ -145,6 +371,9 @@ func (m *manager) Close() error {
 	if m.link != nil {
 		_ = m.link.Close()
 	}
+	if m.egressLink != nil {
+		_ = m.egressLink.Close()
+	}
 	if m.programs != nil {
 		m.programs.Close()
 	}
@@ -157,10 +386,21 @@ type portmapKey struct {
 	Port  uint16
 }
 
-type portmapValue struct {
+type routeStatsValue struct {
+	Packets uint64
+	Bytes   uint64
+}
+
+type portmapBackend struct {
 	DestIP   uint32
 	DestPort uint16
-	_        uint16
+	Weight   uint16
+}
+
+type portmapValue struct {
+	BackendCount uint32
+	TotalWeight  uint32
+	Backends     [routes.MaxBackends]portmapBackend
 }
 
 func htons(value uint16) uint16 {
@@ -4,7 +4,6 @@ package dataplane
 
 import (
 	"context"
-	"net"
 )
 
 func newManager(Options) (Interface, error) {
@@ -13,6 +12,9 @@ func newManager(Options) (Interface, error) {
 
 type noopManager struct{}
 
-func (noopManager) ApplyBridge(context.Context, uint8, uint16, net.IP, uint16) error { return nil }
-func (noopManager) Remove(context.Context, uint8, uint16) error                      { return nil }
-func (noopManager) Close() error                                                     { return nil }
+func (noopManager) ApplyBridge(context.Context, uint8, uint16, []BridgeBackend) error { return nil }
+func (noopManager) ApplyBridgeBatch(context.Context, []BridgeRoute) error             { return nil }
+func (noopManager) Remove(context.Context, uint8, uint16) error                       { return nil }
+func (noopManager) RemoveBatch(context.Context, []BridgeRouteKey) error               { return nil }
+func (noopManager) Stats(context.Context) (Stats, error)                              { return Stats{}, nil }
+func (noopManager) Close() error                                                      { return nil }
@@ -13,10 +13,49 @@ type Options struct {
 	Logger     *slog.Logger
 }
 
+// BridgeBackend is one weighted destination in a route's backend set.
+type BridgeBackend struct {
+	IP     net.IP
+	Port   uint16
+	Weight uint16
+}
+
+// RouteStats aggregates per-route counters summed across CPUs.
+type RouteStats struct {
+	Protocol string `json:"protocol"`
+	HostPort uint16 `json:"host_port"`
+	Packets  uint64 `json:"packets"`
+	Bytes    uint64 `json:"bytes"`
+}
+
+// Stats is a point-in-time snapshot of dataplane counters.
+type Stats struct {
+	Routes        []RouteStats `json:"routes"`
+	LookupMisses  uint64       `json:"lookup_misses"`
+	RewriteErrors uint64       `json:"rewrite_errors"`
+}
+
+// BridgeRoute pairs a portmap key with its backend set for bulk
+// programming.
+type BridgeRoute struct {
+	Proto    uint8
+	HostPort uint16
+	Backends []BridgeBackend
+}
+
+// BridgeRouteKey identifies a portmap entry for bulk removal.
+type BridgeRouteKey struct {
+	Proto    uint8
+	HostPort uint16
+}
+
 // Interface describes bridge dataplane interactions.
 type Interface interface {
-	ApplyBridge(ctx context.Context, proto uint8, hostPort uint16, destIP net.IP, destPort uint16) error
+	ApplyBridge(ctx context.Context, proto uint8, hostPort uint16, backends []BridgeBackend) error
+	ApplyBridgeBatch(ctx context.Context, routes []BridgeRoute) error
 	Remove(ctx context.Context, proto uint8, hostPort uint16) error
+	RemoveBatch(ctx context.Context, keys []BridgeRouteKey) error
+	Stats(ctx context.Context) (Stats, error)
 	Close() error
 }
 
@@ -3,14 +3,18 @@ package httpapi
 import (
 	"encoding/json"
 	"errors"
+	"fmt"
 	"net/http"
 	"strconv"
+	"strings"
 
 	"github.com/go-chi/chi/v5"
 	"github.com/go-chi/chi/v5/middleware"
 
 	"github.com/volantvm/volant/internal/drift/controller"
+	"github.com/volantvm/volant/internal/drift/dataplane"
 	"github.com/volantvm/volant/internal/drift/routes"
+	"github.com/volantvm/volant/internal/telemetry"
 )
 
 // Handler wires HTTP endpoints for Drift route management.
@@ -28,15 +32,28 @@ func New(ctrl *controller.Controller) http.Handler {
 	r.Use(middleware.Recoverer)
 
 	r.Get("/healthz", h.handleHealth)
+	r.Get("/metrics", h.handleMetrics)
+	r.Mount("/debug", middleware.Profiler())
 	r.Group(func(r chi.Router) {
 		r.Get("/routes", h.handleListRoutes)
 		r.Post("/routes", h.handleUpsertRoute)
+		r.Post("/routes/sync", h.handleSyncRoutes)
 		r.Delete("/routes/{protocol}/{port}", h.handleDeleteRoute)
+		r.Get("/stats", h.handleStats)
 	})
 
 	return r
 }
 
+// Metrics returns a standalone Prometheus scrape handler for the
+// metrics listener.
+func Metrics(ctrl *controller.Controller) http.Handler {
+	h := &Handler{controller: ctrl}
+	mux := http.NewServeMux()
+	mux.HandleFunc("/metrics", h.handleMetrics)
+	return mux
+}
+
 func (h *Handler) handleHealth(w http.ResponseWriter, r *http.Request) {
 	w.WriteHeader(http.StatusOK)
 	_, _ = w.Write([]byte("ok"))
@@ -77,6 +94,31 @@ func (h *Handler) handleUpsertRoute(w http.ResponseWriter, r *http.Request) {
 	writeJSON(w, http.StatusCreated, updated)
 }
 
+func (h *Handler) handleSyncRoutes(w http.ResponseWriter, r *http.Request) {
+	ctx := r.Context()
+	var req routes.SyncRequest
+	if err := json.NewDecoder(r.Body).Decode(&req); err != nil {
+		writeError(w, http.StatusBadRequest, "invalid json")
+		return
+	}
+	resp, err := h.controller.Sync(ctx, req)
+	if err != nil {
+		status := http.StatusInternalServerError
+		var validationErr controller.ValidationError
+		if errors.As(err, &validationErr) {
+			status = http.StatusBadRequest
+		} else {
+			var unavailable controller.RuntimeUnavailableError
+			if errors.As(err, &unavailable) {
+				status = http.StatusServiceUnavailable
+			}
+		}
+		writeError(w, status, err.Error())
+		return
+	}
+	writeJSON(w, http.StatusOK, resp)
+}
+
 func (h *Handler) handleDeleteRoute(w http.ResponseWriter, r *http.Request) {
 	ctx := r.Context()
 	protocol := chi.URLParam(r, "protocol")
@@ -101,6 +143,56 @@ func (h *Handler) handleDeleteRoute(w http.ResponseWriter, r *http.Request) {
 	w.WriteHeader(http.StatusNoContent)
 }
 
+func (h *Handler) handleStats(w http.ResponseWriter, r *http.Request) {
+	stats, err := h.controller.Stats(r.Context())
+	if err != nil {
+		status := http.StatusInternalServerError
+		var unavailable controller.RuntimeUnavailableError
+		if errors.As(err, &unavailable) {
+			status = http.StatusServiceUnavailable
+		}
+		writeError(w, status, err.Error())
+		return
+	}
+	writeJSON(w, http.StatusOK, stats)
+}
+
+// handleMetrics renders dataplane counters in the Prometheus text
+// exposition format. Counters are written by hand to avoid pulling a
+// client library into the daemon.
+func (h *Handler) handleMetrics(w http.ResponseWriter, r *http.Request) {
+	stats, err := h.controller.Stats(r.Context())
+	if err != nil {
+		var unavailable controller.RuntimeUnavailableError
+		if !errors.As(err, &unavailable) {
+			http.Error(w, err.Error(), http.StatusInternalServerError)
+			return
+		}
+		stats = dataplane.Stats{}
+	}
+
+	w.Header().Set("Content-Type", "text/plain; version=0.0.4")
+	var b strings.Builder
+	b.WriteString("# HELP drift_route_packets_total Packets rewritten per route.\n")
+	b.WriteString("# TYPE drift_route_packets_total counter\n")
+	for _, route := range stats.Routes {
+		fmt.Fprintf(&b, "drift_route_packets_total{protocol=%q,host_port=\"%d\"} %d\n", route.Protocol, route.HostPort, route.Packets)
+	}
+	b.WriteString("# HELP drift_route_bytes_total Bytes rewritten per route.\n")
+	b.WriteString("# TYPE drift_route_bytes_total counter\n")
+	for _, route := range stats.Routes {
+		fmt.Fprintf(&b, "drift_route_bytes_total{protocol=%q,host_port=\"%d\"} %d\n", route.Protocol, route.HostPort, route.Bytes)
+	}
+	b.WriteString("# HELP drift_lookup_misses_total Ingress packets with no matching route.\n")
+	b.WriteString("# TYPE drift_lookup_misses_total counter\n")
+	fmt.Fprintf(&b, "drift_lookup_misses_total %d\n", stats.LookupMisses)
+	b.WriteString("# HELP drift_rewrite_errors_total Packets a rewrite helper failed to modify.\n")
+	b.WriteString("# TYPE drift_rewrite_errors_total counter\n")
+	fmt.Fprintf(&b, "drift_rewrite_errors_total %d\n", stats.RewriteErrors)
+	telemetry.WritePrometheus(&b)
+	_, _ = w.Write([]byte(b.String()))
+}
+
 func writeJSON(w http.ResponseWriter, status int, payload any) {
 	w.Header().Set("Content-Type", "application/json")
 	w.WriteHeader(status)
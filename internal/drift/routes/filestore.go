@@ -1,6 +1,7 @@
 package routes
 
 import (
+	"bufio"
 	"context"
 	"encoding/json"
 	"errors"
@@ -11,49 +12,124 @@ import (
 	"sync"
 )
 
-// FileStore persists routes to a JSON file on disk.
+// compactThreshold bounds how many WAL records accumulate before the
+// log is folded into a fresh snapshot.
+const compactThreshold = 1024
+
+// FileStore persists routes as a JSON snapshot plus an append-only
+// write-ahead log of mutations. Route churn costs one appended line
+// instead of an O(n) rewrite of the whole table; the log is folded
+// back into the snapshot periodically so startup replay stays short.
 type FileStore struct {
-	path  string
-	mu    sync.RWMutex
-	items map[string]Route
+	path    string
+	walPath string
+	mu      sync.RWMutex
+	items   map[string]Route
+	wal     *os.File
+	walOps  int
+}
+
+type walRecord struct {
+	Op       string `json:"op"`
+	Route    *Route `json:"route,omitempty"`
+	HostPort uint16 `json:"host_port,omitempty"`
+	Protocol string `json:"protocol,omitempty"`
 }
 
-// NewFileStore loads existing routes from path or creates a new empty store.
+const (
+	walOpUpsert = "upsert"
+	walOpDelete = "delete"
+)
+
+// NewFileStore loads the snapshot and replays the WAL from path, or
+// creates a new empty store.
 func NewFileStore(path string) (*FileStore, error) {
 	if strings.TrimSpace(path) == "" {
 		return nil, fmt.Errorf("routes: file path required")
 	}
 	store := &FileStore{
-		path:  path,
-		items: make(map[string]Route),
+		path:    path,
+		walPath: path + ".wal",
+		items:   make(map[string]Route),
 	}
 	if err := store.load(); err != nil {
 		return nil, err
 	}
+	if err := store.openWAL(); err != nil {
+		return nil, err
+	}
 	return store, nil
 }
 
 func (f *FileStore) load() error {
 	data, err := os.ReadFile(f.path)
+	if err != nil && !errors.Is(err, os.ErrNotExist) {
+		return fmt.Errorf("routes: read file: %w", err)
+	}
+
+	if len(data) > 0 {
+		var routes []Route
+		if err := json.Unmarshal(data, &routes); err != nil {
+			return fmt.Errorf("routes: decode file: %w", err)
+		}
+		for _, route := range routes {
+			key := storageKey(route.HostPort, route.Protocol)
+			f.items[key] = route
+		}
+	}
+
+	return f.replayWAL()
+}
+
+// replayWAL folds logged mutations on top of the snapshot. A malformed
+// trailing record (crash mid-append) ends replay; everything before it
+// is intact.
+func (f *FileStore) replayWAL() error {
+	file, err := os.Open(f.walPath)
 	if err != nil {
 		if errors.Is(err, os.ErrNotExist) {
 			return nil
 		}
-		return fmt.Errorf("routes: read file: %w", err)
+		return fmt.Errorf("routes: open wal: %w", err)
 	}
+	defer file.Close()
 
-	var routes []Route
-	if len(data) == 0 {
-		return nil
+	scanner := bufio.NewScanner(file)
+	scanner.Buffer(make([]byte, 0, 64*1024), 1024*1024)
+	for scanner.Scan() {
+		line := scanner.Bytes()
+		if len(line) == 0 {
+			continue
+		}
+		var record walRecord
+		if err := json.Unmarshal(line, &record); err != nil {
+			break
+		}
+		switch record.Op {
+		case walOpUpsert:
+			if record.Route != nil {
+				f.items[storageKey(record.Route.HostPort, record.Route.Protocol)] = *record.Route
+			}
+		case walOpDelete:
+			delete(f.items, storageKey(record.HostPort, record.Protocol))
+		}
+		f.walOps++
 	}
-	if err := json.Unmarshal(data, &routes); err != nil {
-		return fmt.Errorf("routes: decode file: %w", err)
+	if err := scanner.Err(); err != nil {
+		return fmt.Errorf("routes: replay wal: %w", err)
 	}
+	return nil
+}
 
-	for _, route := range routes {
-		key := storageKey(route.HostPort, route.Protocol)
-		f.items[key] = route
+func (f *FileStore) openWAL() error {
+	if err := os.MkdirAll(filepath.Dir(f.walPath), 0o755); err != nil {
+		return fmt.Errorf("routes: ensure directory: %w", err)
+	}
+	file, err := os.OpenFile(f.walPath, os.O_CREATE|os.O_WRONLY|os.O_APPEND, 0o644)
+	if err != nil {
+		return fmt.Errorf("routes: open wal: %w", err)
 	}
+	f.wal = file
 	return nil
 }
 
@@ -80,16 +156,19 @@ func (f *FileStore) Get(_ context.Context, hostPort uint16, protocol string) (*R
 	return nil, fmt.Errorf("%w: %s", ErrNotFound, key)
 }
 
-// Upsert writes or replaces a route on disk.
+// Upsert writes or replaces a route, appending one WAL record.
 func (f *FileStore) Upsert(_ context.Context, route Route) error {
 	key := storageKey(route.HostPort, route.Protocol)
 	f.mu.Lock()
 	defer f.mu.Unlock()
+	if err := f.appendLocked(walRecord{Op: walOpUpsert, Route: &route}); err != nil {
+		return err
+	}
 	f.items[key] = route
-	return f.persistLocked()
+	return f.maybeCompactLocked()
 }
 
-// Delete removes a route from disk.
+// Delete removes a route, appending one WAL record.
 func (f *FileStore) Delete(_ context.Context, hostPort uint16, protocol string) error {
 	key := storageKey(hostPort, protocol)
 	f.mu.Lock()
@@ -97,8 +176,47 @@ func (f *FileStore) Delete(_ context.Context, hostPort uint16, protocol string)
 	if _, ok := f.items[key]; !ok {
 		return fmt.Errorf("%w: %s", ErrNotFound, key)
 	}
+	if err := f.appendLocked(walRecord{Op: walOpDelete, HostPort: hostPort, Protocol: protocol}); err != nil {
+		return err
+	}
 	delete(f.items, key)
-	return f.persistLocked()
+	return f.maybeCompactLocked()
+}
+
+func (f *FileStore) appendLocked(record walRecord) error {
+	data, err := json.Marshal(record)
+	if err != nil {
+		return fmt.Errorf("routes: encode wal record: %w", err)
+	}
+	if _, err := f.wal.Write(append(data, '\n')); err != nil {
+		return fmt.Errorf("routes: append wal: %w", err)
+	}
+	if err := f.wal.Sync(); err != nil {
+		return fmt.Errorf("routes: sync wal: %w", err)
+	}
+	f.walOps++
+	return nil
+}
+
+// maybeCompactLocked folds the WAL into a fresh snapshot once enough
+// records have accumulated.
+func (f *FileStore) maybeCompactLocked() error {
+	if f.walOps < compactThreshold {
+		return nil
+	}
+	if err := f.persistLocked(); err != nil {
+		return err
+	}
+	if err := f.wal.Close(); err != nil {
+		return fmt.Errorf("routes: close wal: %w", err)
+	}
+	file, err := os.OpenFile(f.walPath, os.O_CREATE|os.O_WRONLY|os.O_TRUNC, 0o644)
+	if err != nil {
+		return fmt.Errorf("routes: truncate wal: %w", err)
+	}
+	f.wal = file
+	f.walOps = 0
+	return nil
 }
 
 func (f *FileStore) persistLocked() error {
@@ -1,5 +1,9 @@
 package routes
 
+// MaxBackends caps the size of a route's backend set, mirroring
+// DRIFT_MAX_BACKENDS in the BPF dataplane.
+const MaxBackends = 64
+
 // BackendType represents a routing backend.
 type BackendType string
 
@@ -10,15 +14,55 @@ const (
 
 // Backend describes the routing destination for a host port.
 type Backend struct {
-	Type BackendType `json:"type"`
-	IP   string      `json:"ip,omitempty"`
-	Port uint16      `json:"port"`
-	CID  uint32      `json:"cid,omitempty"`
+	Type   BackendType `json:"type"`
+	IP     string      `json:"ip,omitempty"`
+	Port   uint16      `json:"port"`
+	CID    uint32      `json:"cid,omitempty"`
+	Weight uint16      `json:"weight,omitempty"`
+}
+
+// RouteKey identifies a route for removal in a sync delta.
+type RouteKey struct {
+	HostPort uint16 `json:"host_port"`
+	Protocol string `json:"protocol"`
+}
+
+// SyncRequest carries a generation-stamped delta of route mutations.
+// A generation at or below the last acked one is a replay and is
+// ignored; generation zero applies unconditionally.
+type SyncRequest struct {
+	Generation uint64     `json:"generation"`
+	Adds       []Route    `json:"adds,omitempty"`
+	Removes    []RouteKey `json:"removes,omitempty"`
 }
 
-// Route binds an exposed host port to a backend target.
+// SyncResponse acknowledges the generation the daemon has applied.
+type SyncResponse struct {
+	Generation uint64 `json:"generation"`
+}
+
+// Route binds an exposed host port to a backend target. Bridge routes
+// may carry additional weighted backends; traffic is spread across the
+// set by flow hash in the dataplane.
 type Route struct {
-	HostPort uint16  `json:"host_port"`
-	Protocol string  `json:"protocol"`
-	Backend  Backend `json:"backend"`
+	HostPort uint16    `json:"host_port"`
+	Protocol string    `json:"protocol"`
+	Backend  Backend   `json:"backend"`
+	Backends []Backend `json:"backends,omitempty"`
+}
+
+// Equal reports whether two routes describe the same forwarding state.
+func (r Route) Equal(other Route) bool {
+	if r.HostPort != other.HostPort || r.Protocol != other.Protocol || r.Backend != other.Backend {
+		return false
+	}
+	if len(r.Backends) != len(other.Backends) {
+		return false
+	}
+	for i := range r.Backends {
+		if r.Backends[i] != other.Backends[i] {
+			return false
+		}
+	}
+	return true
 }
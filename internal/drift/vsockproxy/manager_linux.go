@@ -10,18 +10,35 @@ import (
 	"log/slog"
 	"net"
 	"sync"
+	"time"
 
 	"github.com/mdlayher/vsock"
+
+	"github.com/volantvm/volant/internal/telemetry"
+)
+
+// acceptToFirstByte tracks TCP proxy latency from host-side accept to
+// the first reply byte relayed back from the guest, exported on the
+// driftd metrics endpoint.
+var acceptToFirstByte = telemetry.NewHistogram(
+	"drift_vsock_accept_to_first_byte_seconds",
+	"Time from TCP accept to the first byte relayed back from the guest.",
 )
 
 type manager struct {
 	logger   *slog.Logger
 	bindAddr string
 	mu       sync.Mutex
-	proxies  map[string]*proxy
+	proxies  map[string]portProxy
 	closed   bool
 }
 
+// portProxy is the common handle for per-port forwarders (TCP stream
+// proxies and UDP relays).
+type portProxy interface {
+	stop()
+}
+
 type proxy struct {
 	proto     string
 	hostPort  uint16
@@ -46,7 +63,7 @@ func newManager(opts Options) (Manager, error) {
 	return &manager{
 		logger:   logger.With("component", "vsockproxy"),
 		bindAddr: bind,
-		proxies:  make(map[string]*proxy),
+		proxies:  make(map[string]portProxy),
 	}, nil
 }
 
@@ -55,7 +72,7 @@ func (m *manager) key(proto string, port uint16) string {
 }
 
 func (m *manager) Upsert(ctx context.Context, proto string, hostPort uint16, cid uint32, guestPort uint16) error {
-	if proto != "tcp" {
+	if proto != "tcp" && proto != "udp" {
 		return fmt.Errorf("vsock proxy: protocol %q not supported", proto)
 	}
 
@@ -70,24 +87,49 @@ func (m *manager) Upsert(ctx context.Context, proto string, hostPort uint16, cid
 		existing.stop()
 	}
 
-	addr := fmt.Sprintf("%s:%d", m.bindAddr, hostPort)
-	listener, err := net.Listen("tcp", addr)
-	if err != nil {
-		return fmt.Errorf("vsock proxy: listen %s: %w", addr, err)
-	}
-
 	childCtx, cancel := context.WithCancel(context.Background())
-	px := &proxy{
-		proto:     proto,
-		hostPort:  hostPort,
-		cid:       cid,
-		guestPort: guestPort,
-		listener:  listener,
-		cancel:    cancel,
-		done:      make(chan struct{}),
-		logger:    m.logger.With("host_port", hostPort, "cid", cid, "guest_port", guestPort),
+	logger := m.logger.With("host_port", hostPort, "cid", cid, "guest_port", guestPort)
+
+	var px portProxy
+	switch proto {
+	case "tcp":
+		addr := fmt.Sprintf("%s:%d", m.bindAddr, hostPort)
+		listener, err := net.Listen("tcp", addr)
+		if err != nil {
+			cancel()
+			return fmt.Errorf("vsock proxy: listen %s: %w", addr, err)
+		}
+		streamPx := &proxy{
+			proto:     proto,
+			hostPort:  hostPort,
+			cid:       cid,
+			guestPort: guestPort,
+			listener:  listener,
+			cancel:    cancel,
+			done:      make(chan struct{}),
+			logger:    logger,
+		}
+		streamPx.start(childCtx)
+		px = streamPx
+	case "udp":
+		conn, err := net.ListenUDP("udp", &net.UDPAddr{IP: net.ParseIP(m.bindAddr), Port: int(hostPort)})
+		if err != nil {
+			cancel()
+			return fmt.Errorf("vsock proxy: listen udp %s:%d: %w", m.bindAddr, hostPort, err)
+		}
+		udpPx := &udpProxy{
+			hostPort:  hostPort,
+			cid:       cid,
+			guestPort: guestPort,
+			conn:      conn,
+			cancel:    cancel,
+			done:      make(chan struct{}),
+			logger:    logger,
+		}
+		udpPx.start(childCtx)
+		px = udpPx
 	}
-	px.start(childCtx)
+
 	m.proxies[key] = px
 	return nil
 }
@@ -145,6 +187,7 @@ func (p *proxy) start(ctx context.Context) {
 }
 
 func (p *proxy) handleConnection(ctx context.Context, conn net.Conn) {
+	start := time.Now()
 	defer conn.Close()
 	vsockConn, err := dialVsock(ctx, p.cid, uint32(p.guestPort))
 	if err != nil {
@@ -154,15 +197,37 @@ func (p *proxy) handleConnection(ctx context.Context, conn net.Conn) {
 	defer vsockConn.Close()
 
 	var wg sync.WaitGroup
-	copyStream := func(dst io.Writer, src io.Reader) {
+	wg.Add(2)
+	go func() {
 		defer wg.Done()
-		if _, err := io.Copy(dst, src); err != nil {
+		if _, err := relay(vsockConn, conn); err != nil {
 			p.logger.Warn("copy stream", "error", err)
 		}
-	}
-	wg.Add(2)
-	go copyStream(vsockConn, conn)
-	go copyStream(conn, vsockConn)
+	}()
+	go func() {
+		defer wg.Done()
+		// The first reply byte is relayed by hand so accept-to-first-byte
+		// latency can be observed; the rest of the stream goes through
+		// the splice fast path.
+		var first [1]byte
+		n, err := vsockConn.Read(first[:])
+		if n > 0 {
+			if _, werr := conn.Write(first[:n]); werr != nil {
+				p.logger.Warn("copy stream", "error", werr)
+				return
+			}
+			acceptToFirstByte.ObserveSince(start)
+		}
+		if err != nil {
+			if !errors.Is(err, io.EOF) {
+				p.logger.Warn("copy stream", "error", err)
+			}
+			return
+		}
+		if _, err := relay(conn, vsockConn); err != nil {
+			p.logger.Warn("copy stream", "error", err)
+		}
+	}()
 	wg.Wait()
 }
 
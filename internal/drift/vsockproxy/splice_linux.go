@@ -0,0 +1,203 @@
+//go:build linux
+
+package vsockproxy
+
+import (
+	"errors"
+	"io"
+	"net"
+	"sync"
+	"sync/atomic"
+	"syscall"
+
+	"golang.org/x/sys/unix"
+)
+
+const (
+	// spliceChunk is the largest transfer requested per splice call.
+	spliceChunk = 1 << 20
+	// copyBufSize sizes pooled buffers for the fallback copy path.
+	copyBufSize = 64 << 10
+)
+
+var copyBufPool = sync.Pool{
+	New: func() any {
+		buf := make([]byte, copyBufSize)
+		return &buf
+	},
+}
+
+// vsockSpliceBroken latches once the kernel rejects splicing a vsock
+// socket through a pipe, so later connections skip the probe.
+var vsockSpliceBroken atomic.Bool
+
+// relay moves bytes from src to dst until EOF, using a zero-copy
+// splice(2) pipe when the kernel supports it for both endpoints and a
+// pooled buffer copy otherwise. A splice attempt may make partial
+// progress before discovering the path is unsupported, so the fallback
+// continues from wherever it stopped.
+func relay(dst, src net.Conn) (int64, error) {
+	n, err, handled := spliceCopy(dst, src)
+	if handled {
+		return n, err
+	}
+	m, err := bufferCopy(dst, src)
+	return n + m, err
+}
+
+func bufferCopy(dst io.Writer, src io.Reader) (int64, error) {
+	buf := copyBufPool.Get().(*[]byte)
+	defer copyBufPool.Put(buf)
+	return io.CopyBuffer(dst, src, *buf)
+}
+
+func spliceCopy(dst, src net.Conn) (int64, error, bool) {
+	if vsockSpliceBroken.Load() {
+		return 0, nil, false
+	}
+
+	srcConn, ok := src.(syscall.Conn)
+	if !ok {
+		return 0, nil, false
+	}
+	dstConn, ok := dst.(syscall.Conn)
+	if !ok {
+		return 0, nil, false
+	}
+	rawSrc, err := srcConn.SyscallConn()
+	if err != nil {
+		return 0, nil, false
+	}
+	rawDst, err := dstConn.SyscallConn()
+	if err != nil {
+		return 0, nil, false
+	}
+
+	var pipeFDs [2]int
+	if err := unix.Pipe2(pipeFDs[:], unix.O_NONBLOCK|unix.O_CLOEXEC); err != nil {
+		return 0, nil, false
+	}
+	defer unix.Close(pipeFDs[0])
+	defer unix.Close(pipeFDs[1])
+
+	// handled latches after the first full splice round trip; until
+	// then an EINVAL/EOPNOTSUPP from either half means the kernel
+	// cannot splice this socket pair and the buffer copy takes over.
+	var (
+		total   int64
+		handled bool
+	)
+	for {
+		inPipe, err := spliceIn(rawSrc, pipeFDs[1])
+		if err != nil {
+			if !handled && spliceUnsupported(err) {
+				vsockSpliceBroken.Store(true)
+				return total, nil, false
+			}
+			return total, err, true
+		}
+		if inPipe == 0 {
+			return total, nil, true
+		}
+		if err := spliceOut(rawDst, pipeFDs[0], inPipe); err != nil {
+			if !handled && spliceUnsupported(err) {
+				// The bytes already pulled into the pipe must still
+				// reach dst before the fallback resumes from src.
+				vsockSpliceBroken.Store(true)
+				if derr := drainPipe(dst, pipeFDs[0], inPipe); derr != nil {
+					return total, derr, true
+				}
+				return total + inPipe, nil, false
+			}
+			return total, err, true
+		}
+		handled = true
+		total += inPipe
+	}
+}
+
+// drainPipe copies remain bytes already sitting in the pipe out to dst
+// with a regular read/write, used when splicing into dst turns out to
+// be unsupported.
+func drainPipe(dst io.Writer, pipeR int, remain int64) error {
+	buf := copyBufPool.Get().(*[]byte)
+	defer copyBufPool.Put(buf)
+	for remain > 0 {
+		chunk := int64(len(*buf))
+		if chunk > remain {
+			chunk = remain
+		}
+		n, err := unix.Read(pipeR, (*buf)[:chunk])
+		if err == unix.EINTR {
+			continue
+		}
+		if err != nil {
+			return err
+		}
+		if n == 0 {
+			return io.ErrUnexpectedEOF
+		}
+		if _, err := dst.Write((*buf)[:n]); err != nil {
+			return err
+		}
+		remain -= int64(n)
+	}
+	return nil
+}
+
+// spliceIn fills the pipe from the source socket. The pipe is drained
+// completely between rounds, so EAGAIN can only mean the socket has no
+// data and we should wait for read readiness.
+func spliceIn(rc syscall.RawConn, pipeW int) (int64, error) {
+	var (
+		n    int64
+		serr error
+	)
+	err := rc.Read(func(fd uintptr) bool {
+		for {
+			n, serr = unix.Splice(int(fd), nil, pipeW, nil, spliceChunk, unix.SPLICE_F_MOVE|unix.SPLICE_F_NONBLOCK)
+			if serr == unix.EINTR {
+				continue
+			}
+			if serr == unix.EAGAIN {
+				return false
+			}
+			return true
+		}
+	})
+	if err != nil {
+		return 0, err
+	}
+	return n, serr
+}
+
+// spliceOut drains remain bytes from the pipe into the destination
+// socket, waiting for write readiness as needed.
+func spliceOut(rc syscall.RawConn, pipeR int, remain int64) error {
+	var serr error
+	err := rc.Write(func(fd uintptr) bool {
+		for remain > 0 {
+			n, err := unix.Splice(pipeR, nil, int(fd), nil, int(remain), unix.SPLICE_F_MOVE|unix.SPLICE_F_NONBLOCK)
+			if err == unix.EINTR {
+				continue
+			}
+			if err == unix.EAGAIN {
+				return false
+			}
+			if err != nil {
+				serr = err
+				return true
+			}
+			remain -= n
+		}
+		return true
+	})
+	if err != nil {
+		return err
+	}
+	return serr
+}
+
+func spliceUnsupported(err error) bool {
+	return errors.Is(err, unix.EINVAL) || errors.Is(err, unix.ENOSYS) || errors.Is(err, unix.EOPNOTSUPP)
+}
@@ -0,0 +1,324 @@
+//go:build linux
+
+package vsockproxy
+
+import (
+	"bufio"
+	"context"
+	"encoding/binary"
+	"errors"
+	"fmt"
+	"io"
+	"log/slog"
+	"net"
+	"net/netip"
+	"os"
+	"time"
+	"unsafe"
+
+	"github.com/mdlayher/vsock"
+	"golang.org/x/sys/unix"
+)
+
+// UDP datagrams are relayed over a single vsock stream per route, one
+// frame per datagram in both directions:
+//
+//	bytes 0..15  client address (IPv4 addresses are v4-mapped)
+//	bytes 16..17 client port, big endian
+//	bytes 18..21 payload length, big endian
+//	bytes 22..   payload
+//
+// The guest echoes the client address on replies so the host can route
+// them back. Host-side socket I/O batches up to udpBatchSize datagrams
+// per recvmmsg/sendmmsg call to amortize syscall overhead.
+const (
+	udpBatchSize  = 32
+	udpBufSize    = 64 << 10
+	udpHeaderSize = 22
+)
+
+// udpRedialDelay paces reconnect attempts to the guest endpoint.
+const udpRedialDelay = 500 * time.Millisecond
+
+// mmsghdr mirrors the kernel's struct mmsghdr, which x/sys/unix does
+// not expose.
+type mmsghdr struct {
+	hdr unix.Msghdr
+	len uint32
+}
+
+func recvmmsg(fd int, hdrs []mmsghdr, flags int) (int, unix.Errno) {
+	n, _, errno := unix.Syscall6(unix.SYS_RECVMMSG, uintptr(fd), uintptr(unsafe.Pointer(&hdrs[0])), uintptr(len(hdrs)), uintptr(flags), 0, 0)
+	return int(n), errno
+}
+
+func sendmmsg(fd int, hdrs []mmsghdr, flags int) (int, unix.Errno) {
+	n, _, errno := unix.Syscall6(unix.SYS_SENDMMSG, uintptr(fd), uintptr(unsafe.Pointer(&hdrs[0])), uintptr(len(hdrs)), uintptr(flags), 0, 0)
+	return int(n), errno
+}
+
+type udpProxy struct {
+	hostPort  uint16
+	cid       uint32
+	guestPort uint16
+	conn      *net.UDPConn
+	cancel    context.CancelFunc
+	done      chan struct{}
+	logger    *slog.Logger
+}
+
+func (p *udpProxy) start(ctx context.Context) {
+	go p.run(ctx)
+}
+
+// run supervises the vsock connection: dial, relay until one direction
+// fails, redial. Datagrams arriving while the guest is unreachable are
+// dropped, which is acceptable UDP semantics.
+func (p *udpProxy) run(ctx context.Context) {
+	defer close(p.done)
+	p.logger.Info("vsock udp proxy started")
+	for ctx.Err() == nil {
+		vconn, err := dialVsock(ctx, p.cid, uint32(p.guestPort))
+		if err != nil {
+			if ctx.Err() != nil {
+				return
+			}
+			p.logger.Warn("vsock dial failed", "error", err)
+			select {
+			case <-ctx.Done():
+				return
+			case <-time.After(udpRedialDelay):
+			}
+			continue
+		}
+		p.relay(ctx, vconn)
+		_ = vconn.Close()
+	}
+}
+
+// relay runs both directions until either fails or ctx is cancelled.
+func (p *udpProxy) relay(ctx context.Context, vconn *vsock.Conn) {
+	relayCtx, cancel := context.WithCancel(ctx)
+	defer cancel()
+
+	errCh := make(chan error, 2)
+	go func() { errCh <- p.ingress(relayCtx, vconn) }()
+	go func() { errCh <- p.egress(vconn) }()
+
+	var err error
+	select {
+	case <-relayCtx.Done():
+	case err = <-errCh:
+	}
+	cancel()
+	// Closing the vsock conn unblocks the other direction.
+	_ = vconn.Close()
+	if err != nil && ctx.Err() == nil {
+		p.logger.Warn("udp relay interrupted", "error", err)
+	}
+}
+
+// ingress batches datagrams off the host socket with recvmmsg and
+// writes them to the guest as one coalesced frame sequence per batch.
+func (p *udpProxy) ingress(ctx context.Context, vconn *vsock.Conn) error {
+	rawConn, err := p.conn.SyscallConn()
+	if err != nil {
+		return err
+	}
+
+	bufs := make([][]byte, udpBatchSize)
+	names := make([]unix.RawSockaddrInet6, udpBatchSize)
+	iovecs := make([]unix.Iovec, udpBatchSize)
+	hdrs := make([]mmsghdr, udpBatchSize)
+	for i := range bufs {
+		bufs[i] = make([]byte, udpBufSize)
+		iovecs[i].Base = &bufs[i][0]
+		iovecs[i].SetLen(udpBufSize)
+		hdrs[i].hdr.Name = (*byte)(unsafe.Pointer(&names[i]))
+		hdrs[i].hdr.Namelen = unix.SizeofSockaddrInet6
+		hdrs[i].hdr.Iov = &iovecs[i]
+		hdrs[i].hdr.SetIovlen(1)
+	}
+
+	out := make([]byte, 0, udpBatchSize*2048)
+	for {
+		if err := ctx.Err(); err != nil {
+			return err
+		}
+		// A short deadline lets the loop observe cancellation while the
+		// socket is idle.
+		_ = p.conn.SetReadDeadline(time.Now().Add(time.Second))
+
+		var count int
+		var errno unix.Errno
+		for i := range hdrs {
+			hdrs[i].hdr.Namelen = unix.SizeofSockaddrInet6
+			iovecs[i].SetLen(udpBufSize)
+		}
+		err := rawConn.Read(func(fd uintptr) bool {
+			count, errno = recvmmsg(int(fd), hdrs, 0)
+			return errno != unix.EAGAIN
+		})
+		if err != nil {
+			if errors.Is(err, os.ErrDeadlineExceeded) {
+				continue
+			}
+			return err
+		}
+		if errno != 0 {
+			return errno
+		}
+
+		out = out[:0]
+		for i := 0; i < count; i++ {
+			addr, ok := sockaddrToAddrPort(&names[i])
+			if !ok {
+				continue
+			}
+			out = appendUDPFrame(out, addr, bufs[i][:hdrs[i].len])
+		}
+		if len(out) == 0 {
+			continue
+		}
+		if _, err := vconn.Write(out); err != nil {
+			return err
+		}
+	}
+}
+
+// egress reads reply frames from the guest, opportunistically draining
+// whatever is already buffered to form a batch, and flushes it with one
+// sendmmsg call.
+func (p *udpProxy) egress(vconn *vsock.Conn) error {
+	rawConn, err := p.conn.SyscallConn()
+	if err != nil {
+		return err
+	}
+
+	reader := bufio.NewReaderSize(vconn, udpBufSize)
+	header := make([]byte, udpHeaderSize)
+	payloads := make([][]byte, udpBatchSize)
+	names := make([]unix.RawSockaddrInet6, udpBatchSize)
+	iovecs := make([]unix.Iovec, udpBatchSize)
+	hdrs := make([]mmsghdr, udpBatchSize)
+	lengths := make([]int, udpBatchSize)
+	for i := range payloads {
+		payloads[i] = make([]byte, udpBufSize)
+		iovecs[i].Base = &payloads[i][0]
+		hdrs[i].hdr.Iov = &iovecs[i]
+		hdrs[i].hdr.SetIovlen(1)
+	}
+
+	for {
+		addr, n, err := readUDPFrame(reader, header, payloads[0])
+		if err != nil {
+			return err
+		}
+		lengths[0] = n
+		setSockaddr(&names[0], &hdrs[0].hdr, addr)
+		count := 1
+
+		// Drain frames the guest already flushed into our buffer.
+		for count < udpBatchSize && reader.Buffered() >= udpHeaderSize {
+			addr, n, err := readUDPFrame(reader, header, payloads[count])
+			if err != nil {
+				return err
+			}
+			lengths[count] = n
+			setSockaddr(&names[count], &hdrs[count].hdr, addr)
+			count++
+		}
+
+		for i := 0; i < count; i++ {
+			iovecs[i].SetLen(lengths[i])
+		}
+
+		sent := 0
+		for sent < count {
+			var n int
+			var errno unix.Errno
+			batch := hdrs[sent:count]
+			err := rawConn.Write(func(fd uintptr) bool {
+				n, errno = sendmmsg(int(fd), batch, 0)
+				return errno != unix.EAGAIN
+			})
+			if err != nil {
+				return err
+			}
+			if errno != 0 {
+				return errno
+			}
+			sent += n
+		}
+	}
+}
+
+func (p *udpProxy) stop() {
+	p.cancel()
+	_ = p.conn.Close()
+	<-p.done
+	p.logger.Info("vsock udp proxy stopped")
+}
+
+func appendUDPFrame(out []byte, addr netip.AddrPort, payload []byte) []byte {
+	a16 := addr.Addr().As16()
+	out = append(out, a16[:]...)
+	out = binary.BigEndian.AppendUint16(out, addr.Port())
+	out = binary.BigEndian.AppendUint32(out, uint32(len(payload)))
+	return append(out, payload...)
+}
+
+func readUDPFrame(reader *bufio.Reader, header, payload []byte) (netip.AddrPort, int, error) {
+	if _, err := io.ReadFull(reader, header); err != nil {
+		return netip.AddrPort{}, 0, err
+	}
+	var a16 [16]byte
+	copy(a16[:], header[:16])
+	addr := netip.AddrFrom16(a16).Unmap()
+	port := binary.BigEndian.Uint16(header[16:18])
+	length := binary.BigEndian.Uint32(header[18:22])
+	if length > uint32(len(payload)) {
+		return netip.AddrPort{}, 0, fmt.Errorf("vsock proxy: udp frame of %d bytes exceeds limit", length)
+	}
+	if _, err := io.ReadFull(reader, payload[:length]); err != nil {
+		return netip.AddrPort{}, 0, err
+	}
+	return netip.AddrPortFrom(addr, port), int(length), nil
+}
+
+// sockaddrToAddrPort decodes the peer address recvmmsg wrote into the
+// shared storage (RawSockaddrInet6 is large enough for both families).
+func sockaddrToAddrPort(raw *unix.RawSockaddrInet6) (netip.AddrPort, bool) {
+	switch raw.Family {
+	case unix.AF_INET:
+		v4 := (*unix.RawSockaddrInet4)(unsafe.Pointer(raw))
+		addr := netip.AddrFrom4(v4.Addr)
+		return netip.AddrPortFrom(addr, ntohs(v4.Port)), true
+	case unix.AF_INET6:
+		addr := netip.AddrFrom16(raw.Addr).Unmap()
+		return netip.AddrPortFrom(addr, ntohs(raw.Port)), true
+	default:
+		return netip.AddrPort{}, false
+	}
+}
+
+// setSockaddr encodes addr into the shared storage and points the
+// msghdr's name at it for sendmmsg.
+func setSockaddr(raw *unix.RawSockaddrInet6, hdr *unix.Msghdr, addr netip.AddrPort) {
+	if addr.Addr().Is4() || addr.Addr().Is4In6() {
+		v4 := (*unix.RawSockaddrInet4)(unsafe.Pointer(raw))
+		*v4 = unix.RawSockaddrInet4{Family: unix.AF_INET, Port: htons(addr.Port())}
+		v4.Addr = addr.Addr().Unmap().As4()
+		hdr.Name = (*byte)(unsafe.Pointer(raw))
+		hdr.Namelen = unix.SizeofSockaddrInet4
+		return
+	}
+	*raw = unix.RawSockaddrInet6{Family: unix.AF_INET6, Port: htons(addr.Port())}
+	raw.Addr = addr.Addr().As16()
+	hdr.Name = (*byte)(unsafe.Pointer(raw))
+	hdr.Namelen = unix.SizeofSockaddrInet6
+}
+
+// Raw sockaddr ports are in network byte order.
+func htons(v uint16) uint16 { return v<<8 | v>>8 }
+func ntohs(v uint16) uint16 { return v<<8 | v>>8 }
@@ -36,10 +36,18 @@ const (
 	RootFSDeviceKey = "volant.rootfs_device"
 	// RootFSFSTypeKey indicates the filesystem type for the root filesystem device.
 	RootFSFSTypeKey = "volant.rootfs_fstype"
+	// RootFSModeKey selects how the agent mounts the root filesystem: direct (default) or overlay,
+	// where the base device is mounted read-only with a tmpfs overlay for writes.
+	RootFSModeKey = "volant.rootfs_mode"
 	// BootModeKey controls the agent boot strategy: auto|initramfs|rootfs
 	BootModeKey = "volant.boot"
 )
 
+// ReadinessVsockPort is the host-side vsock port the agent pushes
+// workload readiness transitions to. volantd listens on it so
+// boot-to-ready detection does not wait on a poll interval.
+const ReadinessVsockPort uint32 = 4090
+
 // Manifest captures the metadata required to register and boot a runtime plugin.
 type Manifest struct {
 	SchemaVersion string            `json:"schema_version"`
@@ -73,6 +81,10 @@ type RootFS struct {
 	URL      string `json:"url"`
 	Checksum string `json:"checksum,omitempty"`
 	Format   string `json:"format,omitempty"`
+	// Shared attaches the base image read-only from a single host file
+	// shared across all replicas, with a per-VM overlay for writes.
+	// Requires a checksum so the image can be content-addressed.
+	Shared bool `json:"shared,omitempty"`
 }
 
 type Initramfs struct {
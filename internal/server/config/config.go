@@ -11,6 +11,7 @@ import (
 	"net/url"
 	"os"
 	"path/filepath"
+	"strconv"
 	"strings"
 )
 
@@ -26,6 +27,8 @@ const (
 	defaultBZImagePath   = "/var/lib/volant/kernel/bzImage"
 	defaultVMLinuxPath   = "/var/lib/volant/kernel/vmlinux"
 	defaultDriftEndpoint = ""
+
+	defaultDeployParallelism = 8
 )
 
 // ServerConfig captures the runtime configuration required by the daemon.
@@ -43,6 +46,16 @@ type ServerConfig struct {
 	LogDir           string
 	DriftEndpoint    string
 	DriftAPIKey      string
+	// DeployParallelism bounds how many deployment replicas are
+	// created and booted concurrently during reconcile.
+	DeployParallelism int
+	// WarmPoolSize keeps this many pre-booted microVMs per plugin
+	// configuration so starts can claim a warm instance instead of
+	// cold-booting. Zero disables the pool.
+	WarmPoolSize int
+	// VMSnapshots snapshots microVMs on clean stop and restores them
+	// on the next start instead of cold-booting.
+	VMSnapshots bool
 }
 
 // FromEnv loads server configuration from environment variables, applying
@@ -62,6 +75,31 @@ func FromEnv() (ServerConfig, error) {
 		DriftAPIKey:      strings.TrimSpace(os.Getenv("VOLANT_DRIFT_API_KEY")),
 	}
 
+	cfg.DeployParallelism = defaultDeployParallelism
+	if raw := strings.TrimSpace(os.Getenv("VOLANT_DEPLOY_PARALLELISM")); raw != "" {
+		parsed, err := strconv.Atoi(raw)
+		if err != nil || parsed < 1 {
+			return ServerConfig{}, fmt.Errorf("invalid deploy parallelism %q", raw)
+		}
+		cfg.DeployParallelism = parsed
+	}
+
+	if raw := strings.TrimSpace(os.Getenv("VOLANT_WARM_POOL_SIZE")); raw != "" {
+		parsed, err := strconv.Atoi(raw)
+		if err != nil || parsed < 0 {
+			return ServerConfig{}, fmt.Errorf("invalid warm pool size %q", raw)
+		}
+		cfg.WarmPoolSize = parsed
+	}
+
+	if raw := strings.TrimSpace(os.Getenv("VOLANT_VM_SNAPSHOTS")); raw != "" {
+		parsed, err := strconv.ParseBool(raw)
+		if err != nil {
+			return ServerConfig{}, fmt.Errorf("invalid vm snapshots flag %q", raw)
+		}
+		cfg.VMSnapshots = parsed
+	}
+
 	if cfg.DriftEndpoint == "" {
 		cfg.DriftEndpoint = defaultDriftEndpoint
 	} else {
@@ -176,6 +176,13 @@ func (r *vmRepository) UpdateKernelCmdline(ctx context.Context, id int64, cmdlin
 	return nil
 }
 
+func (r *vmRepository) UpdateIdentity(ctx context.Context, id int64, ipAddress, macAddress string, vsockCID uint32, kernelCmdline string) error {
+	if _, err := r.exec.ExecContext(ctx, `UPDATE vms SET ip_address = ?, mac_address = ?, vsock_cid = ?, kernel_cmdline = ?, updated_at = CURRENT_TIMESTAMP WHERE id = ?;`, ipAddress, macAddress, vsockCID, nullableString(kernelCmdline), id); err != nil {
+		return fmt.Errorf("update vm identity: %w", err)
+	}
+	return nil
+}
+
 func (r *vmRepository) UpdateSockets(ctx context.Context, id int64, serial string) error {
 	if _, err := r.exec.ExecContext(ctx, `UPDATE vms SET serial_socket = ?, console_socket = NULL, updated_at = CURRENT_TIMESTAMP WHERE id = ?;`, nullableString(serial), id); err != nil {
 		return fmt.Errorf("update vm sockets: %w", err)
@@ -203,34 +210,10 @@ type ipRepository struct {
 
 var _ db.IPRepository = (*ipRepository)(nil)
 
-func (r *ipRepository) EnsurePool(ctx context.Context, ips []string) error {
-	for _, ip := range ips {
-		if _, err := r.exec.ExecContext(ctx, `INSERT OR IGNORE INTO ip_allocations (ip_address, status) VALUES (?, ?);`, ip, string(db.IPStatusAvailable)); err != nil {
-			return fmt.Errorf("ensure pool entry %s: %w", ip, err)
-		}
-	}
-	return nil
-}
-
-func (r *ipRepository) LeaseNextAvailable(ctx context.Context) (*db.IPAllocation, error) {
-	row := r.exec.QueryRowContext(ctx, `SELECT ip_address FROM ip_allocations WHERE status = ? ORDER BY ip_address ASC LIMIT 1;`, string(db.IPStatusAvailable))
-	var ip string
-	if err := row.Scan(&ip); err != nil {
-		if err == sql.ErrNoRows {
-			return nil, db.ErrNoAvailableIPs
-		}
-		return nil, fmt.Errorf("select next available ip: %w", err)
-	}
-
-	if _, err := r.exec.ExecContext(ctx, `UPDATE ip_allocations SET status = ?, vm_id = NULL, leased_at = CURRENT_TIMESTAMP WHERE ip_address = ?;`, string(db.IPStatusLeased), ip); err != nil {
-		return nil, fmt.Errorf("mark ip leased: %w", err)
-	}
-
-	return r.Lookup(ctx, ip)
-}
-
 func (r *ipRepository) LeaseSpecific(ctx context.Context, ip string) (*db.IPAllocation, error) {
-	res, err := r.exec.ExecContext(ctx, `UPDATE ip_allocations SET status = ?, vm_id = NULL, leased_at = CURRENT_TIMESTAMP WHERE ip_address = ? AND status = ?;`, string(db.IPStatusLeased), ip, string(db.IPStatusAvailable))
+	res, err := r.exec.ExecContext(ctx, `INSERT INTO ip_allocations (ip_address, status, vm_id, leased_at) VALUES (?, ?, NULL, CURRENT_TIMESTAMP)
+		ON CONFLICT(ip_address) DO UPDATE SET status = excluded.status, vm_id = NULL, leased_at = excluded.leased_at WHERE status = ?;`,
+		ip, string(db.IPStatusLeased), string(db.IPStatusAvailable))
 	if err != nil {
 		return nil, fmt.Errorf("lease specific ip: %w", err)
 	}
@@ -244,6 +227,23 @@ func (r *ipRepository) LeaseSpecific(ctx context.Context, ip string) (*db.IPAllo
 	return r.Lookup(ctx, ip)
 }
 
+func (r *ipRepository) ListLeased(ctx context.Context) ([]string, error) {
+	rows, err := r.exec.QueryContext(ctx, `SELECT ip_address FROM ip_allocations WHERE status = ?;`, string(db.IPStatusLeased))
+	if err != nil {
+		return nil, fmt.Errorf("list leased ips: %w", err)
+	}
+	defer rows.Close()
+	var ips []string
+	for rows.Next() {
+		var ip string
+		if err := rows.Scan(&ip); err != nil {
+			return nil, fmt.Errorf("scan leased ip: %w", err)
+		}
+		ips = append(ips, ip)
+	}
+	return ips, rows.Err()
+}
+
 func (r *ipRepository) Assign(ctx context.Context, ip string, vmID int64) error {
 	res, err := r.exec.ExecContext(ctx, `UPDATE ip_allocations SET vm_id = ? WHERE ip_address = ? AND status = ?;`, vmID, ip, string(db.IPStatusLeased))
 	if err != nil {
@@ -25,9 +25,11 @@ import (
 //go:embed migrations/*.sql
 var migrationsFS embed.FS
 
-// Store wraps a SQLite connection pool with migration metadata.
+// Store wraps a SQLite connection pool with migration metadata and a
+// prepared-statement cache shared by all repositories.
 type Store struct {
-	db *sql.DB
+	db    *sql.DB
+	cache *stmtCache
 }
 
 // Open establishes a SQLite connection, applies migrations, and enables
@@ -42,7 +44,11 @@ func Open(ctx context.Context, path string) (*Store, error) {
 		return nil, fmt.Errorf("ensure database directory: %w", err)
 	}
 
-	dsn := fmt.Sprintf("file:%s?_busy_timeout=5000&_foreign_keys=1", expanded)
+	// WAL lets readers proceed while a writer commits and turns the
+	// per-transaction journal churn into sequential appends; synchronous
+	// NORMAL is the recommended pairing (fsync on checkpoint, not on
+	// every commit).
+	dsn := fmt.Sprintf("file:%s?_busy_timeout=10000&_foreign_keys=1&_journal_mode=WAL&_synchronous=NORMAL", expanded)
 	db, err := sql.Open("sqlite3", dsn)
 	if err != nil {
 		return nil, fmt.Errorf("open sqlite: %w", err)
@@ -58,11 +64,12 @@ func Open(ctx context.Context, path string) (*Store, error) {
 		return nil, err
 	}
 
-	return &Store{db: db}, nil
+	return &Store{db: db, cache: newStmtCache(db)}, nil
 }
 
 // Close shuts down the underlying connection pool.
 func (s *Store) Close(ctx context.Context) error {
+	s.cache.close()
 	closeCh := make(chan error, 1)
 	go func() { closeCh <- s.db.Close() }()
 
@@ -76,7 +83,7 @@ func (s *Store) Close(ctx context.Context) error {
 
 // Queries returns repository accessors bound to the root connection.
 func (s *Store) Queries() db.Queries {
-	return &queries{exec: s.db}
+	return &queries{exec: &cachedDB{db: s.db, cache: s.cache}}
 }
 
 // WithTx executes fn within a SQL transaction, rolling back on error.
@@ -86,7 +93,7 @@ func (s *Store) WithTx(ctx context.Context, fn func(db.Queries) error) error {
 		return fmt.Errorf("begin tx: %w", err)
 	}
 
-	q := &queries{exec: tx}
+	q := &queries{exec: &cachedTx{tx: tx, cache: s.cache}}
 	if err := fn(q); err != nil {
 		if rbErr := tx.Rollback(); rbErr != nil {
 			return fmt.Errorf("rollback tx after error %v: %w", err, rbErr)
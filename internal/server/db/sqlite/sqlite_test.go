@@ -23,11 +23,6 @@ func TestVMRepositoryCRUD(t *testing.T) {
 	t.Cleanup(func() { _ = store.Close(ctx) })
 
 	vmRepo := store.Queries().VirtualMachines()
-	ipRepo := store.Queries().IPAllocations()
-
-	if err := ipRepo.EnsurePool(ctx, []string{"192.168.127.2", "192.168.127.3"}); err != nil {
-		t.Fatalf("ensure pool: %v", err)
-	}
 
 	vm := &db.VM{
 		Name:       "vm-1",
@@ -105,13 +100,10 @@ func TestIPRepositoryLeaseAndAssign(t *testing.T) {
 	t.Cleanup(func() { _ = store.Close(ctx) })
 
 	ipRepo := store.Queries().IPAllocations()
-	if err := ipRepo.EnsurePool(ctx, []string{"192.168.127.10", "192.168.127.11"}); err != nil {
-		t.Fatalf("ensure pool: %v", err)
-	}
 
 	var leasedIP string
 	err := store.WithTx(ctx, func(q db.Queries) error {
-		allocation, err := q.IPAllocations().LeaseNextAvailable(ctx)
+		allocation, err := q.IPAllocations().LeaseSpecific(ctx, "192.168.127.10")
 		if err != nil {
 			return err
 		}
@@ -168,28 +160,32 @@ func openTestStore(t *testing.T) *Store {
 	return store
 }
 
-func TestEnsurePoolIdempotent(t *testing.T) {
+func TestLeaseSpecificCreatesRowLazily(t *testing.T) {
 	ctx := context.Background()
 	store := openTestStore(t)
 	t.Cleanup(func() { _ = store.Close(ctx) })
 
 	ipRepo := store.Queries().IPAllocations()
 
-	ips := []string{"192.168.127.50", "192.168.127.51"}
-	for i := 0; i < 3; i++ {
-		if err := ipRepo.EnsurePool(ctx, ips); err != nil {
-			t.Fatalf("ensure pool iteration %d: %v", i, err)
-		}
+	// The pool is no longer materialized up front; the first lease for
+	// an address creates its row.
+	if _, err := ipRepo.LeaseSpecific(ctx, "192.168.127.50"); err != nil {
+		t.Fatalf("lease specific: %v", err)
 	}
 
-	for _, ip := range ips {
-		alloc, err := ipRepo.Lookup(ctx, ip)
-		if err != nil {
-			t.Fatalf("lookup %s: %v", ip, err)
-		}
-		if alloc == nil || alloc.Status != db.IPStatusAvailable {
-			t.Fatalf("ip %s not available after ensure: %+v", ip, alloc)
-		}
+	leased, err := ipRepo.ListLeased(ctx)
+	if err != nil {
+		t.Fatalf("list leased: %v", err)
+	}
+	if len(leased) != 1 || leased[0] != "192.168.127.50" {
+		t.Fatalf("unexpected leased set: %v", leased)
+	}
+
+	if err := ipRepo.Release(ctx, "192.168.127.50"); err != nil {
+		t.Fatalf("release: %v", err)
+	}
+	if _, err := ipRepo.LeaseSpecific(ctx, "192.168.127.50"); err != nil {
+		t.Fatalf("lease after release: %v", err)
 	}
 }
 
@@ -199,9 +195,6 @@ func TestLeaseSpecificUnavailable(t *testing.T) {
 	t.Cleanup(func() { _ = store.Close(ctx) })
 
 	ipRepo := store.Queries().IPAllocations()
-	if err := ipRepo.EnsurePool(ctx, []string{"192.168.127.80"}); err != nil {
-		t.Fatalf("ensure pool: %v", err)
-	}
 
 	if _, err := ipRepo.LeaseSpecific(ctx, "192.168.127.80"); err != nil {
 		t.Fatalf("lease specific first attempt: %v", err)
@@ -211,17 +204,6 @@ func TestLeaseSpecificUnavailable(t *testing.T) {
 	}
 }
 
-func TestLeaseNextAvailableEmptyPool(t *testing.T) {
-	ctx := context.Background()
-	store := openTestStore(t)
-	t.Cleanup(func() { _ = store.Close(ctx) })
-
-	_, err := store.Queries().IPAllocations().LeaseNextAvailable(ctx)
-	if err != db.ErrNoAvailableIPs {
-		t.Fatalf("expected ErrNoAvailableIPs, got %v", err)
-	}
-}
-
 func TestTimestampCoercionHandlesRFC3339(t *testing.T) {
 	ts, err := coerceTime("2025-09-23T12:34:56Z")
 	if err != nil {
@@ -0,0 +1,123 @@
+// Copyright (c) 2025 HYPR. PTE. LTD.
+//
+// Business Source License 1.1
+// See LICENSE file in the project root for details.
+
+package sqlite
+
+import (
+	"context"
+	"database/sql"
+	"sync"
+)
+
+// stmtCache memoizes prepared statements keyed by SQL text so repeated
+// queries skip the parse/plan step. With the pool pinned to a single
+// connection (see configurePool) a cached statement never needs to be
+// re-prepared on another connection, so reuse is essentially free.
+type stmtCache struct {
+	db    *sql.DB
+	mu    sync.RWMutex
+	stmts map[string]*sql.Stmt
+}
+
+func newStmtCache(db *sql.DB) *stmtCache {
+	return &stmtCache{db: db, stmts: make(map[string]*sql.Stmt)}
+}
+
+func (c *stmtCache) get(ctx context.Context, query string) (*sql.Stmt, error) {
+	c.mu.RLock()
+	stmt, ok := c.stmts[query]
+	c.mu.RUnlock()
+	if ok {
+		return stmt, nil
+	}
+
+	prepared, err := c.db.PrepareContext(ctx, query)
+	if err != nil {
+		return nil, err
+	}
+
+	c.mu.Lock()
+	defer c.mu.Unlock()
+	if existing, ok := c.stmts[query]; ok {
+		_ = prepared.Close()
+		return existing, nil
+	}
+	c.stmts[query] = prepared
+	return prepared, nil
+}
+
+func (c *stmtCache) close() {
+	c.mu.Lock()
+	defer c.mu.Unlock()
+	for _, stmt := range c.stmts {
+		_ = stmt.Close()
+	}
+	c.stmts = make(map[string]*sql.Stmt)
+}
+
+// cachedDB satisfies the executor interface over the root connection,
+// routing queries through the statement cache.
+type cachedDB struct {
+	db    *sql.DB
+	cache *stmtCache
+}
+
+func (c *cachedDB) ExecContext(ctx context.Context, query string, args ...any) (sql.Result, error) {
+	stmt, err := c.cache.get(ctx, query)
+	if err != nil {
+		return nil, err
+	}
+	return stmt.ExecContext(ctx, args...)
+}
+
+func (c *cachedDB) QueryContext(ctx context.Context, query string, args ...any) (*sql.Rows, error) {
+	stmt, err := c.cache.get(ctx, query)
+	if err != nil {
+		return nil, err
+	}
+	return stmt.QueryContext(ctx, args...)
+}
+
+func (c *cachedDB) QueryRowContext(ctx context.Context, query string, args ...any) *sql.Row {
+	stmt, err := c.cache.get(ctx, query)
+	if err != nil {
+		// *sql.Row cannot carry a prepare error; fall back to the raw
+		// path and let the driver surface it on Scan.
+		return c.db.QueryRowContext(ctx, query, args...)
+	}
+	return stmt.QueryRowContext(ctx, args...)
+}
+
+// cachedTx satisfies the executor interface inside a transaction. Cached
+// statements are bound to the transaction with Tx.StmtContext, which
+// reuses the prepared handle rather than re-preparing.
+type cachedTx struct {
+	tx    *sql.Tx
+	cache *stmtCache
+}
+
+func (c *cachedTx) ExecContext(ctx context.Context, query string, args ...any) (sql.Result, error) {
+	stmt, err := c.cache.get(ctx, query)
+	if err != nil {
+		return nil, err
+	}
+	return c.tx.StmtContext(ctx, stmt).ExecContext(ctx, args...)
+}
+
+func (c *cachedTx) QueryContext(ctx context.Context, query string, args ...any) (*sql.Rows, error) {
+	stmt, err := c.cache.get(ctx, query)
+	if err != nil {
+		return nil, err
+	}
+	return c.tx.StmtContext(ctx, stmt).QueryContext(ctx, args...)
+}
+
+func (c *cachedTx) QueryRowContext(ctx context.Context, query string, args ...any) *sql.Row {
+	stmt, err := c.cache.get(ctx, query)
+	if err != nil {
+		return c.tx.QueryRowContext(ctx, query, args...)
+	}
+	return c.tx.StmtContext(ctx, stmt).QueryRowContext(ctx, args...)
+}
@@ -155,6 +155,7 @@ type VMRepository interface {
 	List(ctx context.Context) ([]VM, error)
 	ListByGroupID(ctx context.Context, groupID int64) ([]VM, error)
 	UpdateRuntimeState(ctx context.Context, id int64, status VMStatus, pid *int64) error
+	UpdateIdentity(ctx context.Context, id int64, ipAddress, macAddress string, vsockCID uint32, kernelCmdline string) error
 	UpdateKernelCmdline(ctx context.Context, id int64, cmdline string) error
 	UpdateSockets(ctx context.Context, id int64, serial string) error
 	UpdateSpec(ctx context.Context, id int64, runtime string, cpuCores, memoryMB int, kernelCmdline string) error
@@ -194,12 +195,13 @@ type VMCloudInitRepository interface {
 	Delete(ctx context.Context, vmID int64) error
 }
 
-// IPRepository manages deterministic IP allocation.
+// IPRepository records IP leases. Free-address selection lives in the
+// orchestrator's in-memory allocator; rows exist only for addresses
+// that have been leased at least once.
 type IPRepository interface {
-	EnsurePool(ctx context.Context, ips []string) error
-	LeaseNextAvailable(ctx context.Context) (*IPAllocation, error)
 	LeaseSpecific(ctx context.Context, ip string) (*IPAllocation, error)
 	Assign(ctx context.Context, ip string, vmID int64) error
 	Release(ctx context.Context, ip string) error
 	Lookup(ctx context.Context, ip string) (*IPAllocation, error)
+	ListLeased(ctx context.Context) ([]string, error)
 }
@@ -6,12 +6,14 @@
 package devicemanager
 
 import (
+	"errors"
 	"fmt"
 	"log/slog"
 	"os"
 	"path/filepath"
 	"regexp"
 	"strings"
+	"sync"
 )
 
 const (
@@ -70,6 +72,15 @@ type PCIDevice struct {
 type vfioManager struct {
 	logger     *slog.Logger
 	fileSystem FileSystem
+
+	// iommuGroups caches device address -> IOMMU group ID, populated by
+	// one walk of /sys/kernel/iommu_groups on first use instead of a
+	// symlink read per device per VM start. Group membership is fixed by
+	// hardware topology, so the cache never goes stale for known devices;
+	// hot-added devices are picked up through the per-device fallback in
+	// getIOMMUGroup.
+	topoMu      sync.RWMutex
+	iommuGroups map[string]string
 }
 
 // FileSystem interface for testability (allows mocking filesystem operations)
@@ -194,61 +205,77 @@ func (m *vfioManager) CheckIOMMUGroups(pciAddrs []string) ([]IOMMUGroup, error)
 	return result, nil
 }
 
-// BindDevices binds devices to the vfio-pci driver
+// BindDevices binds devices to the vfio-pci driver. Each device's
+// unbind/bind sequence is independent and driver detach is the slow step
+// (seconds for GPU drivers), so multi-device VMs prepare their devices
+// concurrently instead of serially.
 func (m *vfioManager) BindDevices(pciAddrs []string) error {
 	m.logger.Info("binding devices to vfio-pci driver", "count", len(pciAddrs))
 
-	for _, addr := range pciAddrs {
-		// Check current driver
-		currentDriver, err := m.getCurrentDriver(addr)
-		if err != nil {
-			m.logger.Warn("failed to get current driver", "device", addr, "error", err)
-		}
+	errs := make([]error, len(pciAddrs))
+	var wg sync.WaitGroup
+	for i, addr := range pciAddrs {
+		wg.Add(1)
+		go func(i int, addr string) {
+			defer wg.Done()
+			errs[i] = m.bindDevice(addr)
+		}(i, addr)
+	}
+	wg.Wait()
 
-		// If already bound to vfio-pci, skip
-		if currentDriver == vfioPCIDriver {
-			m.logger.Debug("device already bound to vfio-pci", "address", addr)
-			continue
-		}
+	return errors.Join(errs...)
+}
 
-		// Unbind from current driver if any
-		if currentDriver != "" {
-			if err := m.unbindDriver(addr, currentDriver); err != nil {
-				return fmt.Errorf("failed to unbind %s from %s: %w", addr, currentDriver, err)
-			}
-			m.logger.Debug("unbound from current driver", "address", addr, "driver", currentDriver)
-		}
+// bindDevice moves one device onto the vfio-pci driver.
+func (m *vfioManager) bindDevice(addr string) error {
+	// Check current driver
+	currentDriver, err := m.getCurrentDriver(addr)
+	if err != nil {
+		m.logger.Warn("failed to get current driver", "device", addr, "error", err)
+	}
 
-		// Get device vendor:device ID for driver override
-		vendor, device, err := m.getDeviceID(addr)
-		if err != nil {
-			return fmt.Errorf("failed to read device ID for %s: %w", addr, err)
-		}
+	// If already bound to vfio-pci, skip
+	if currentDriver == vfioPCIDriver {
+		m.logger.Debug("device already bound to vfio-pci", "address", addr)
+		return nil
+	}
 
-		// Add device ID to vfio-pci driver's new_id to enable binding
-		newIDPath := "/sys/bus/pci/drivers/vfio-pci/new_id"
-		idString := fmt.Sprintf("%s %s", vendor, device)
-		if err := m.fileSystem.WriteFile(newIDPath, []byte(idString)); err != nil {
-			// Ignore "file exists" errors - device may already be registered
-			if !strings.Contains(err.Error(), "exist") {
-				m.logger.Warn("failed to add device ID to vfio-pci", "error", err)
-			}
+	// Unbind from current driver if any
+	if currentDriver != "" {
+		if err := m.unbindDriver(addr, currentDriver); err != nil {
+			return fmt.Errorf("failed to unbind %s from %s: %w", addr, currentDriver, err)
 		}
+		m.logger.Debug("unbound from current driver", "address", addr, "driver", currentDriver)
+	}
 
-		// Bind to vfio-pci driver
-		bindPath := "/sys/bus/pci/drivers/vfio-pci/bind"
-		if err := m.fileSystem.WriteFile(bindPath, []byte(addr)); err != nil {
-			// Check if device is now bound (bind may fail if already bound)
-			if newDriver, _ := m.getCurrentDriver(addr); newDriver == vfioPCIDriver {
-				m.logger.Debug("device now bound to vfio-pci", "address", addr)
-			} else {
-				return fmt.Errorf("failed to bind %s to vfio-pci: %w", addr, err)
-			}
+	// Get device vendor:device ID for driver override
+	vendor, device, err := m.getDeviceID(addr)
+	if err != nil {
+		return fmt.Errorf("failed to read device ID for %s: %w", addr, err)
+	}
+
+	// Add device ID to vfio-pci driver's new_id to enable binding
+	newIDPath := "/sys/bus/pci/drivers/vfio-pci/new_id"
+	idString := fmt.Sprintf("%s %s", vendor, device)
+	if err := m.fileSystem.WriteFile(newIDPath, []byte(idString)); err != nil {
+		// Ignore "file exists" errors - device may already be registered
+		if !strings.Contains(err.Error(), "exist") {
+			m.logger.Warn("failed to add device ID to vfio-pci", "error", err)
 		}
+	}
 
-		m.logger.Info("successfully bound device to vfio-pci", "address", addr)
+	// Bind to vfio-pci driver
+	bindPath := "/sys/bus/pci/drivers/vfio-pci/bind"
+	if err := m.fileSystem.WriteFile(bindPath, []byte(addr)); err != nil {
+		// Check if device is now bound (bind may fail if already bound)
+		if newDriver, _ := m.getCurrentDriver(addr); newDriver == vfioPCIDriver {
+			m.logger.Debug("device now bound to vfio-pci", "address", addr)
+		} else {
+			return fmt.Errorf("failed to bind %s to vfio-pci: %w", addr, err)
+		}
 	}
 
+	m.logger.Info("successfully bound device to vfio-pci", "address", addr)
 	return nil
 }
 
@@ -256,26 +283,37 @@ func (m *vfioManager) BindDevices(pciAddrs []string) error {
 func (m *vfioManager) UnbindDevices(pciAddrs []string) error {
 	m.logger.Info("unbinding devices from vfio-pci", "count", len(pciAddrs))
 
+	var wg sync.WaitGroup
 	for _, addr := range pciAddrs {
-		currentDriver, err := m.getCurrentDriver(addr)
-		if err != nil {
-			m.logger.Warn("failed to get current driver during unbind", "device", addr, "error", err)
-			continue
-		}
-
-		if currentDriver == vfioPCIDriver {
-			if err := m.unbindDriver(addr, vfioPCIDriver); err != nil {
-				m.logger.Warn("failed to unbind device", "address", addr, "error", err)
-				// Continue with other devices
-			} else {
-				m.logger.Debug("unbound device from vfio-pci", "address", addr)
-			}
-		}
+		wg.Add(1)
+		go func(addr string) {
+			defer wg.Done()
+			m.unbindDevice(addr)
+		}(addr)
 	}
+	wg.Wait()
 
 	return nil
 }
 
+// unbindDevice releases one device from vfio-pci; failures are logged so
+// the remaining devices are still released.
+func (m *vfioManager) unbindDevice(addr string) {
+	currentDriver, err := m.getCurrentDriver(addr)
+	if err != nil {
+		m.logger.Warn("failed to get current driver during unbind", "device", addr, "error", err)
+		return
+	}
+
+	if currentDriver == vfioPCIDriver {
+		if err := m.unbindDriver(addr, vfioPCIDriver); err != nil {
+			m.logger.Warn("failed to unbind device", "address", addr, "error", err)
+		} else {
+			m.logger.Debug("unbound device from vfio-pci", "address", addr)
+		}
+	}
+}
+
 // GetVFIOGroupPaths returns /dev/vfio/GROUP_NUMBER paths for the devices
 func (m *vfioManager) GetVFIOGroupPaths(pciAddrs []string) ([]string, error) {
 	devicePaths := make([]string, 0, len(pciAddrs))
@@ -413,8 +451,66 @@ func (m *vfioManager) getCurrentDriver(pciAddr string) (string, error) {
 	return driverName, nil
 }
 
-// getIOMMUGroup returns the IOMMU group ID for a device
+// getIOMMUGroup returns the IOMMU group ID for a device, consulting the
+// cached topology first. A miss falls back to the per-device symlink so
+// hot-added devices are still resolved (and cached for next time).
 func (m *vfioManager) getIOMMUGroup(pciAddr string) (string, error) {
+	m.topoMu.RLock()
+	loaded := m.iommuGroups != nil
+	groupID, ok := m.iommuGroups[pciAddr]
+	m.topoMu.RUnlock()
+	if ok {
+		return groupID, nil
+	}
+
+	if !loaded {
+		m.topoMu.Lock()
+		if m.iommuGroups == nil {
+			m.iommuGroups = m.loadIOMMUTopology()
+		}
+		groupID, ok = m.iommuGroups[pciAddr]
+		m.topoMu.Unlock()
+		if ok {
+			return groupID, nil
+		}
+	}
+
+	groupID, err := m.readIOMMUGroup(pciAddr)
+	if err != nil || groupID == "" {
+		return groupID, err
+	}
+	m.topoMu.Lock()
+	m.iommuGroups[pciAddr] = groupID
+	m.topoMu.Unlock()
+	return groupID, nil
+}
+
+// loadIOMMUTopology captures device -> group membership for every device
+// in one walk of /sys/kernel/iommu_groups.
+func (m *vfioManager) loadIOMMUTopology() map[string]string {
+	topo := make(map[string]string)
+
+	groups, err := m.fileSystem.ReadDir(iommuGroupsPath)
+	if err != nil {
+		m.logger.Debug("failed to enumerate IOMMU groups", "error", err)
+		return topo
+	}
+	for _, group := range groups {
+		devices, err := m.fileSystem.ReadDir(filepath.Join(iommuGroupsPath, group.Name(), "devices"))
+		if err != nil {
+			continue
+		}
+		for _, device := range devices {
+			topo[device.Name()] = group.Name()
+		}
+	}
+
+	m.logger.Debug("cached IOMMU topology", "groups", len(groups), "devices", len(topo))
+	return topo
+}
+
+// readIOMMUGroup reads a single device's IOMMU group from its sysfs symlink
+func (m *vfioManager) readIOMMUGroup(pciAddr string) (string, error) {
 	groupPath := filepath.Join(pciDevicesPath, pciAddr, "iommu_group")
 
 	if !m.fileSystem.Exists(groupPath) {
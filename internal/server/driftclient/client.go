@@ -102,6 +102,28 @@ func (c *Client) UpsertRoute(ctx context.Context, route routes.Route) (routes.Ro
 	return result, nil
 }
 
+// SyncRoutes pushes a generation-stamped delta of route mutations and
+// returns the generation Drift has acked.
+func (c *Client) SyncRoutes(ctx context.Context, sync routes.SyncRequest) (*routes.SyncResponse, error) {
+	if !c.Enabled() {
+		return nil, ErrDisabled
+	}
+	body, err := json.Marshal(sync)
+	if err != nil {
+		return nil, err
+	}
+	req, err := c.newRequest(ctx, http.MethodPost, "/routes/sync", bytes.NewReader(body))
+	if err != nil {
+		return nil, err
+	}
+	req.Header.Set("Content-Type", "application/json")
+	var result routes.SyncResponse
+	if err := c.do(req, &result); err != nil {
+		return nil, err
+	}
+	return &result, nil
+}
+
 // DeleteRoute removes a route from Drift.
 func (c *Client) DeleteRoute(ctx context.Context, protocol string, hostPort uint16) error {
 	if !c.Enabled() {
@@ -9,58 +9,207 @@ import (
 	"context"
 	"errors"
 	"sync"
+	"sync/atomic"
 
 	"github.com/volantvm/volant/internal/server/eventbus"
 )
 
-// Bus is an in-memory event bus suitable for single-node development testing.
+// ringSize bounds the per-subscriber buffer between the publisher and the
+// subscriber's channel. When it overflows the oldest event is overwritten,
+// so a slow consumer sees the most recent state rather than a stale prefix.
+const ringSize = 256
+
+// Bus is an in-memory event bus suitable for single-node deployments.
+// Publishing never blocks: each subscriber owns a bounded ring buffer
+// drained by a dedicated goroutine, so one slow consumer cannot stall
+// publishers or its peers, and locking is per topic rather than global.
 type Bus struct {
 	mu     sync.RWMutex
-	topics map[string][]chan<- any
+	topics map[string]*topic
 }
 
 var _ eventbus.Bus = (*Bus)(nil)
 
 // New creates a new Bus instance.
 func New() *Bus {
-	return &Bus{topics: make(map[string][]chan<- any)}
+	return &Bus{topics: make(map[string]*topic)}
+}
+
+type topic struct {
+	mu   sync.RWMutex
+	subs []*subscriber
+}
+
+type subscriber struct {
+	ch chan<- any
+
+	mu    sync.Mutex
+	ring  [ringSize]any
+	head  int // index of the oldest buffered event
+	count int
+
+	wake    chan struct{}
+	done    chan struct{}
+	dropped atomic.Uint64
+}
+
+// SubscriberStats reports the backlog and loss accounting for one subscriber.
+type SubscriberStats struct {
+	Buffered int
+	Dropped  uint64
 }
 
-// Publish fan-outs payloads to subscribers.
-func (b *Bus) Publish(ctx context.Context, topic string, payload any) error {
+// Publish fans payloads out to subscribers without blocking. Events for a
+// slow consumer displace the oldest buffered entry and are counted against
+// that subscriber's drop counter.
+func (b *Bus) Publish(ctx context.Context, topicName string, payload any) error {
+	if err := ctx.Err(); err != nil {
+		return err
+	}
+
 	b.mu.RLock()
-	defer b.mu.RUnlock()
-	for _, ch := range b.topics[topic] {
-		select {
-		case <-ctx.Done():
-			return ctx.Err()
-		case ch <- payload:
-		default:
-		}
+	t := b.topics[topicName]
+	b.mu.RUnlock()
+	if t == nil {
+		return nil
+	}
+
+	t.mu.RLock()
+	defer t.mu.RUnlock()
+	for _, sub := range t.subs {
+		sub.push(payload)
 	}
 	return nil
 }
 
 // Subscribe registers a channel for a topic.
-func (b *Bus) Subscribe(topic string, ch chan<- any) (func(), error) {
+func (b *Bus) Subscribe(topicName string, ch chan<- any) (func(), error) {
 	if ch == nil {
 		return nil, errors.New("eventbus: channel must not be nil")
 	}
+
+	sub := &subscriber{
+		ch:   ch,
+		wake: make(chan struct{}, 1),
+		done: make(chan struct{}),
+	}
+	go sub.deliver()
+
 	b.mu.Lock()
-	defer b.mu.Unlock()
-	b.topics[topic] = append(b.topics[topic], ch)
+	t := b.topics[topicName]
+	if t == nil {
+		t = &topic{}
+		b.topics[topicName] = t
+	}
+	// Append while still holding b.mu: empty-topic cleanup in the cancel
+	// func re-checks membership under b.mu before deleting, so a topic
+	// found here cannot be removed before the subscriber lands in it.
+	t.mu.Lock()
+	t.subs = append(t.subs, sub)
+	t.mu.Unlock()
+	b.mu.Unlock()
+
 	return func() {
-		b.mu.Lock()
-		defer b.mu.Unlock()
-		subs := b.topics[topic]
-		for i := range subs {
-			if subs[i] == ch {
-				b.topics[topic] = append(subs[:i], subs[i+1:]...)
+		t.mu.Lock()
+		for i := range t.subs {
+			if t.subs[i] == sub {
+				t.subs = append(t.subs[:i], t.subs[i+1:]...)
 				break
 			}
 		}
-		if len(b.topics[topic]) == 0 {
-			delete(b.topics, topic)
+		empty := len(t.subs) == 0
+		t.mu.Unlock()
+
+		close(sub.done)
+
+		if empty {
+			b.mu.Lock()
+			t.mu.RLock()
+			if len(t.subs) == 0 && b.topics[topicName] == t {
+				delete(b.topics, topicName)
+			}
+			t.mu.RUnlock()
+			b.mu.Unlock()
 		}
 	}, nil
 }
+
+// Stats returns per-subscriber backlog and drop counters for a topic, in
+// subscription order. It exists so operators can see slow consumers
+// instead of discovering losses after the fact.
+func (b *Bus) Stats(topicName string) []SubscriberStats {
+	b.mu.RLock()
+	t := b.topics[topicName]
+	b.mu.RUnlock()
+	if t == nil {
+		return nil
+	}
+
+	t.mu.RLock()
+	defer t.mu.RUnlock()
+	stats := make([]SubscriberStats, 0, len(t.subs))
+	for _, sub := range t.subs {
+		sub.mu.Lock()
+		buffered := sub.count
+		sub.mu.Unlock()
+		stats = append(stats, SubscriberStats{Buffered: buffered, Dropped: sub.dropped.Load()})
+	}
+	return stats
+}
+
+// push appends an event to the subscriber's ring, overwriting the oldest
+// entry when full, and nudges the delivery goroutine.
+func (s *subscriber) push(payload any) {
+	s.mu.Lock()
+	if s.count == ringSize {
+		s.ring[s.head] = payload
+		s.head = (s.head + 1) % ringSize
+		s.dropped.Add(1)
+	} else {
+		s.ring[(s.head+s.count)%ringSize] = payload
+		s.count++
+	}
+	s.mu.Unlock()
+
+	select {
+	case s.wake <- struct{}{}:
+	default:
+	}
+}
+
+// deliver drains the ring in batches into the subscriber's channel. A
+// blocked channel only parks this goroutine; the ring keeps absorbing
+// (and, if necessary, dropping) events in the meantime.
+func (s *subscriber) deliver() {
+	var batch []any
+	for {
+		select {
+		case <-s.done:
+			return
+		case <-s.wake:
+		}
+
+		for {
+			s.mu.Lock()
+			batch = batch[:0]
+			for s.count > 0 {
+				batch = append(batch, s.ring[s.head])
+				s.ring[s.head] = nil
+				s.head = (s.head + 1) % ringSize
+				s.count--
+			}
+			s.mu.Unlock()
+
+			if len(batch) == 0 {
+				break
+			}
+			for _, payload := range batch {
+				select {
+				case <-s.done:
+					return
+				case s.ch <- payload:
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,140 @@
+// Copyright (c) 2025 HYPR. PTE. LTD.
+//
+// Business Source License 1.1
+// See LICENSE file in the project root for details.
+
+package memory
+
+import (
+	"context"
+	"sync"
+	"testing"
+	"time"
+)
+
+func TestPublishDeliversToSubscribers(t *testing.T) {
+	bus := New()
+	ch := make(chan any, 4)
+	unsubscribe, err := bus.Subscribe("vm.events", ch)
+	if err != nil {
+		t.Fatalf("subscribe: %v", err)
+	}
+	defer unsubscribe()
+
+	if err := bus.Publish(context.Background(), "vm.events", "created"); err != nil {
+		t.Fatalf("publish: %v", err)
+	}
+
+	select {
+	case got := <-ch:
+		if got != "created" {
+			t.Fatalf("unexpected payload: %v", got)
+		}
+	case <-time.After(time.Second):
+		t.Fatalf("event not delivered")
+	}
+}
+
+func TestSlowConsumerDropsAreCounted(t *testing.T) {
+	bus := New()
+	// An unbuffered channel with no reader keeps the delivery goroutine
+	// parked, so overflow accumulates in the ring.
+	ch := make(chan any)
+	unsubscribe, err := bus.Subscribe("vm.events", ch)
+	if err != nil {
+		t.Fatalf("subscribe: %v", err)
+	}
+	defer unsubscribe()
+
+	ctx := context.Background()
+	for i := 0; i < ringSize*2; i++ {
+		if err := bus.Publish(ctx, "vm.events", i); err != nil {
+			t.Fatalf("publish %d: %v", i, err)
+		}
+	}
+
+	stats := bus.Stats("vm.events")
+	if len(stats) != 1 {
+		t.Fatalf("expected one subscriber, got %d", len(stats))
+	}
+	if stats[0].Dropped == 0 {
+		t.Fatalf("expected drops for slow consumer, got %+v", stats[0])
+	}
+
+	// The newest event must survive the overwrites.
+	var last any
+	deadline := time.After(time.Second)
+	for {
+		select {
+		case last = <-ch:
+			if last == ringSize*2-1 {
+				return
+			}
+		case <-deadline:
+			t.Fatalf("newest event not delivered; last seen %v", last)
+		}
+	}
+}
+
+func TestUnsubscribeRemovesTopic(t *testing.T) {
+	bus := New()
+	ch := make(chan any, 1)
+	unsubscribe, err := bus.Subscribe("vm.events", ch)
+	if err != nil {
+		t.Fatalf("subscribe: %v", err)
+	}
+	unsubscribe()
+
+	if stats := bus.Stats("vm.events"); stats != nil {
+		t.Fatalf("expected topic removal, got %+v", stats)
+	}
+	if err := bus.Publish(context.Background(), "vm.events", "ignored"); err != nil {
+		t.Fatalf("publish after unsubscribe: %v", err)
+	}
+}
+
+func TestSubscribeDuringTopicCleanup(t *testing.T) {
+	bus := New()
+
+	// Cancelling a topic's last subscriber races its empty-topic cleanup
+	// against a fresh Subscribe; the new subscriber must never land in a
+	// topic object Publish can no longer find.
+	for i := 0; i < 200; i++ {
+		first := make(chan any, 1)
+		cancelFirst, err := bus.Subscribe("vm.events", first)
+		if err != nil {
+			t.Fatalf("subscribe first: %v", err)
+		}
+
+		second := make(chan any, 1)
+		var cancelSecond func()
+		var wg sync.WaitGroup
+		wg.Add(2)
+		go func() {
+			defer wg.Done()
+			cancelFirst()
+		}()
+		go func() {
+			defer wg.Done()
+			var err error
+			cancelSecond, err = bus.Subscribe("vm.events", second)
+			if err != nil {
+				t.Errorf("subscribe second: %v", err)
+			}
+		}()
+		wg.Wait()
+		if t.Failed() {
+			t.FailNow()
+		}
+
+		if err := bus.Publish(context.Background(), "vm.events", i); err != nil {
+			t.Fatalf("publish: %v", err)
+		}
+		select {
+		case <-second:
+		case <-time.After(2 * time.Second):
+			t.Fatalf("iteration %d: subscriber attached to orphaned topic", i)
+		}
+		cancelSecond()
+	}
+}
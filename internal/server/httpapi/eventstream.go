@@ -0,0 +1,166 @@
+// Copyright (c) 2025 HYPR. PTE. LTD.
+//
+// Business Source License 1.1
+// See LICENSE file in the project root for details.
+
+package httpapi
+
+import (
+	"log/slog"
+	"strconv"
+	"strings"
+	"sync"
+
+	"github.com/volantvm/volant/internal/server/eventbus"
+	orchestratorevents "github.com/volantvm/volant/internal/server/orchestrator/events"
+)
+
+// eventHistorySize bounds how many lifecycle events are retained for
+// resuming disconnected stream clients via Last-Event-ID.
+const eventHistorySize = 1024
+
+// numberedEvent pairs a lifecycle event with its stream cursor.
+type numberedEvent struct {
+	id    uint64
+	event orchestratorevents.VMEvent
+}
+
+// vmEventStream subscribes once to the orchestrator's VM event topic,
+// assigns monotonically increasing cursor IDs, keeps a bounded replay
+// history, and fans numbered events out to connected SSE clients. A
+// client whose buffer fills is evicted (its channel closed) so it
+// reconnects and resumes from its last cursor instead of stalling the
+// fan-out.
+type vmEventStream struct {
+	logger *slog.Logger
+
+	mu     sync.Mutex
+	ring   []numberedEvent
+	nextID uint64
+	subs   map[chan numberedEvent]struct{}
+}
+
+func newVMEventStream(bus eventbus.Bus, logger *slog.Logger) *vmEventStream {
+	s := &vmEventStream{
+		logger: logger,
+		ring:   make([]numberedEvent, 0, eventHistorySize),
+		nextID: 1,
+		subs:   make(map[chan numberedEvent]struct{}),
+	}
+
+	ch := make(chan any, 256)
+	// The subscription lives for the life of the process; there is no
+	// server teardown path that would unsubscribe it.
+	if _, err := bus.Subscribe(orchestratorevents.TopicVMEvents, ch); err != nil {
+		logger.Error("subscribe vm event stream", "error", err)
+		return nil
+	}
+	go s.run(ch)
+	return s
+}
+
+func (s *vmEventStream) run(ch <-chan any) {
+	for payload := range ch {
+		event, ok := payload.(orchestratorevents.VMEvent)
+		if !ok {
+			continue
+		}
+
+		s.mu.Lock()
+		numbered := numberedEvent{id: s.nextID, event: event}
+		s.nextID++
+		if len(s.ring) == eventHistorySize {
+			s.ring = append(s.ring[:0], s.ring[1:]...)
+		}
+		s.ring = append(s.ring, numbered)
+
+		for sub := range s.subs {
+			select {
+			case sub <- numbered:
+			default:
+				// Slow client: evict it so reconnect-and-resume takes
+				// over rather than blocking every other subscriber.
+				delete(s.subs, sub)
+				close(sub)
+			}
+		}
+		s.mu.Unlock()
+	}
+}
+
+// register returns buffered history newer than afterID together with a
+// live channel. Replay and subscription happen under one lock, so no
+// event can fall between the replayed history and the live feed.
+func (s *vmEventStream) register(afterID uint64) (replay []numberedEvent, live <-chan numberedEvent, cancel func()) {
+	ch := make(chan numberedEvent, 64)
+
+	s.mu.Lock()
+	for _, ev := range s.ring {
+		if ev.id > afterID {
+			replay = append(replay, ev)
+		}
+	}
+	s.subs[ch] = struct{}{}
+	s.mu.Unlock()
+
+	cancel = func() {
+		s.mu.Lock()
+		if _, ok := s.subs[ch]; ok {
+			delete(s.subs, ch)
+			close(ch)
+		}
+		s.mu.Unlock()
+	}
+	return replay, ch, cancel
+}
+
+// vmEventFilter narrows a stream to particular VM names and/or event
+// types, both supplied as comma-separated query values.
+type vmEventFilter struct {
+	names map[string]struct{}
+	types map[string]struct{}
+}
+
+func newVMEventFilter(names, types string) vmEventFilter {
+	return vmEventFilter{names: splitFilter(names), types: splitFilter(types)}
+}
+
+func splitFilter(raw string) map[string]struct{} {
+	if strings.TrimSpace(raw) == "" {
+		return nil
+	}
+	set := make(map[string]struct{})
+	for _, part := range strings.Split(raw, ",") {
+		if trimmed := strings.TrimSpace(part); trimmed != "" {
+			set[trimmed] = struct{}{}
+		}
+	}
+	return set
+}
+
+func (f vmEventFilter) matches(event orchestratorevents.VMEvent) bool {
+	if f.names != nil {
+		if _, ok := f.names[event.Name]; !ok {
+			return false
+		}
+	}
+	if f.types != nil {
+		if _, ok := f.types[event.Type]; !ok {
+			return false
+		}
+	}
+	return true
+}
+
+// parseCursor resolves the resume position, preferring the standard
+// Last-Event-ID header over the `after` query parameter.
+func parseCursor(lastEventID, after string) (uint64, error) {
+	raw := strings.TrimSpace(lastEventID)
+	if raw == "" {
+		raw = strings.TrimSpace(after)
+	}
+	if raw == "" {
+		return 0, nil
+	}
+	return strconv.ParseUint(raw, 10, 64)
+}
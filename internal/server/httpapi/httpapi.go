@@ -16,6 +16,7 @@ import (
 	"log/slog"
 	"net"
 	"net/http"
+	_ "net/http/pprof"
 	"net/url"
 	"os"
 	"strconv"
@@ -36,6 +37,7 @@ import (
 	orchestratorevents "github.com/volantvm/volant/internal/server/orchestrator/events"
 	"github.com/volantvm/volant/internal/server/orchestrator/vmconfig"
 	"github.com/volantvm/volant/internal/server/plugins"
+	"github.com/volantvm/volant/internal/telemetry"
 )
 
 const (
@@ -89,6 +91,9 @@ func New(logger *slog.Logger, engine orchestrator.Engine, bus eventbus.Bus, plug
 		plugins:     plugins,
 		drift:       drift,
 	}
+	if bus != nil {
+		api.stream = newVMEventStream(bus, logger)
+	}
 
 	r.GET("/healthz", func(c *gin.Context) {
 		c.JSON(http.StatusOK, gin.H{"status": "ok"})
@@ -99,6 +104,11 @@ func New(logger *slog.Logger, engine orchestrator.Engine, bus eventbus.Bus, plug
 		api.serveOpenAPI(c.Writer, c.Request)
 	})
 
+	// Hot-path latency histograms and runtime profiling. The pprof
+	// import registers its handlers on the default mux.
+	r.GET("/metrics", gin.WrapH(telemetry.Handler()))
+	r.Any("/debug/pprof/*profile", gin.WrapH(http.DefaultServeMux))
+
 	v1 := r.Group("/api/v1")
 	{
 		v1.GET("/system/status", api.systemStatus)
@@ -119,6 +129,7 @@ func New(logger *slog.Logger, engine orchestrator.Engine, bus eventbus.Bus, plug
 			vms.POST(":name/stop", api.stopVM)
 			vms.POST(":name/restart", api.restartVM)
 			vms.GET(":name/openapi", api.getVMOpenAPI)
+			vms.GET(":name/boot-timeline", api.getVMBootTimeline)
 			vms.Any(":name/agent/*path", api.proxyAgent)
 			vms.POST(":name/actions/:plugin/:action", api.postVMPluginAction)
 		}
@@ -183,31 +194,7 @@ func loadStoredPlugins(engine orchestrator.Engine, logger *slog.Logger, registry
 	if engine == nil || registry == nil {
 		return nil
 	}
-	store := engine.Store()
-	if store == nil {
-		return nil
-	}
-	return store.WithTx(context.Background(), func(q db.Queries) error {
-		entries, err := q.Plugins().List(context.Background())
-		if err != nil {
-			return err
-		}
-		for _, entry := range entries {
-			var manifest pluginspec.Manifest
-			if len(entry.Metadata) > 0 {
-				if err := json.Unmarshal(entry.Metadata, &manifest); err != nil {
-					logger.Warn("decode plugin manifest", "plugin", entry.Name, "error", err)
-					continue
-				}
-			} else {
-				manifest = pluginspec.Manifest{Name: entry.Name, Version: entry.Version}
-			}
-			manifest.Enabled = entry.Enabled
-			manifest.Normalize()
-			registry.Register(manifest)
-		}
-		return nil
-	})
+	return registry.Prefetch(context.Background())
 }
 
 func requestLogger(logger *slog.Logger) gin.HandlerFunc {
@@ -333,6 +320,7 @@ type apiServer struct {
 	logger      *slog.Logger
 	engine      orchestrator.Engine
 	bus         eventbus.Bus
+	stream      *vmEventStream
 	plugins     *plugins.Registry
 	agentPort   int
 	agentClient *http.Client
@@ -1018,7 +1006,7 @@ func (api *apiServer) deleteDeployment(c *gin.Context) {
 }
 
 func (api *apiServer) streamVMEvents(c *gin.Context) {
-	if api.bus == nil {
+	if api.stream == nil {
 		c.JSON(http.StatusServiceUnavailable, gin.H{"error": "event streaming not available"})
 		return
 	}
@@ -1029,43 +1017,65 @@ func (api *apiServer) streamVMEvents(c *gin.Context) {
 		return
 	}
 
-	ctx := c.Request.Context()
-	eventsCh := make(chan any, 16)
-	unsubscribe, err := api.bus.Subscribe(orchestratorevents.TopicVMEvents, eventsCh)
+	after, err := parseCursor(c.GetHeader("Last-Event-ID"), c.Query("after"))
 	if err != nil {
-		c.JSON(http.StatusInternalServerError, gin.H{"error": "failed to subscribe"})
+		c.JSON(http.StatusBadRequest, gin.H{"error": "invalid event cursor"})
 		return
 	}
-	defer unsubscribe()
+	filter := newVMEventFilter(c.Query("name"), c.Query("type"))
+
+	replay, live, cancel := api.stream.register(after)
+	defer cancel()
 
 	c.Writer.Header().Set("Content-Type", "text/event-stream")
 	c.Writer.Header().Set("Cache-Control", "no-cache")
 	c.Writer.Header().Set("Connection", "keep-alive")
 
+	write := func(ev numberedEvent) bool {
+		data, err := json.Marshal(ev.event)
+		if err != nil {
+			api.logger.Error("marshal vm event", "error", err)
+			return true
+		}
+		if _, err := c.Writer.Write([]byte("id: " + strconv.FormatUint(ev.id, 10) + "\n")); err != nil {
+			return false
+		}
+		if _, err := c.Writer.Write([]byte("event: " + ev.event.Type + "\n")); err != nil {
+			return false
+		}
+		if _, err := c.Writer.Write([]byte("data: " + string(data) + "\n\n")); err != nil {
+			return false
+		}
+		flusher.Flush()
+		return true
+	}
+
+	for _, ev := range replay {
+		if !filter.matches(ev.event) {
+			continue
+		}
+		if !write(ev) {
+			return
+		}
+	}
+
+	ctx := c.Request.Context()
 	for {
 		select {
 		case <-ctx.Done():
 			return
-		case payload := <-eventsCh:
-			if payload == nil {
-				continue
-			}
-			vmEvent, ok := payload.(orchestratorevents.VMEvent)
+		case ev, ok := <-live:
 			if !ok {
-				continue
+				// Evicted as a slow consumer; the client reconnects
+				// with Last-Event-ID and resumes from history.
+				return
 			}
-			data, err := json.Marshal(vmEvent)
-			if err != nil {
-				api.logger.Error("marshal vm event", "error", err)
+			if !filter.matches(ev.event) {
 				continue
 			}
-			if _, err := c.Writer.Write([]byte("event: " + vmEvent.Type + "\n")); err != nil {
-				return
-			}
-			if _, err := c.Writer.Write([]byte("data: " + string(data) + "\n\n")); err != nil {
+			if !write(ev) {
 				return
 			}
-			flusher.Flush()
 		}
 	}
 }
@@ -1215,6 +1225,50 @@ func (api *apiServer) handleMCP(c *gin.Context) {
 	c.JSON(http.StatusOK, resp)
 }
 
+// getVMBootTimeline returns the boot phase timeline the guest agent
+// assembled from the C init and kestrel marks, so boot latency can be
+// broken down per phase without serial-console archaeology.
+func (api *apiServer) getVMBootTimeline(c *gin.Context) {
+	name := c.Param("name")
+	if strings.TrimSpace(name) == "" {
+		c.JSON(http.StatusBadRequest, gin.H{"error": "vm name required"})
+		return
+	}
+
+	vm, err := api.engine.GetVM(c.Request.Context(), name)
+	if err != nil {
+		api.logger.Error("get vm boot timeline", "vm", name, "error", err)
+		c.JSON(http.StatusInternalServerError, gin.H{"error": "failed to resolve vm"})
+		return
+	}
+	if vm == nil {
+		c.JSON(http.StatusNotFound, gin.H{"error": "vm not found"})
+		return
+	}
+	if vm.Status != db.VMStatusRunning || strings.TrimSpace(vm.IPAddress) == "" {
+		c.JSON(http.StatusConflict, gin.H{"error": "vm is not running"})
+		return
+	}
+
+	req, err := http.NewRequestWithContext(c.Request.Context(), http.MethodGet, api.agentURL(vm, "/v1/boot-timeline"), nil)
+	if err != nil {
+		c.JSON(http.StatusInternalServerError, gin.H{"error": "failed to build agent request"})
+		return
+	}
+	resp, err := api.agentClient.Do(req)
+	if err != nil {
+		c.JSON(http.StatusBadGateway, gin.H{"error": "agent unreachable"})
+		return
+	}
+	defer resp.Body.Close()
+	data, err := io.ReadAll(resp.Body)
+	if err != nil {
+		c.JSON(http.StatusBadGateway, gin.H{"error": "failed to read agent response"})
+		return
+	}
+	c.Data(resp.StatusCode, "application/json", data)
+}
+
 // getVMOpenAPI serves the VM plugin's OpenAPI document.
 // Precedence: 1) agent http://<vm.ip>:8080/v1/openapi, 2) manifest.OpenAPI URL, else 404.
 func (api *apiServer) getVMOpenAPI(c *gin.Context) {
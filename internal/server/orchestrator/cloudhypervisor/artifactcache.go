@@ -0,0 +1,292 @@
+// Copyright (c) 2025 HYPR. PTE. LTD.
+//
+// Business Source License 1.1
+// See LICENSE file in the project root for details.
+
+package cloudhypervisor
+
+import (
+	"context"
+	"crypto/sha256"
+	"encoding/hex"
+	"fmt"
+	"io"
+	"net/http"
+	"os"
+	"path/filepath"
+	"strings"
+	"sync"
+)
+
+const (
+	// chunkedThreshold is the artifact size above which downloads are
+	// split into parallel ranged requests.
+	chunkedThreshold = 64 << 20
+	// downloadParts is how many ranged requests fetch one artifact.
+	downloadParts = 4
+)
+
+// stageArtifact places an artifact at dst, serving it from the
+// content-addressed cache when the manifest carries a checksum. The
+// cache downloads each object once, verifies it, and hands out
+// reflink (or, for read-only artifacts, hardlink) copies so booting N
+// replicas moves the bytes once instead of N times. Writable artifacts
+// never share inodes with the cache object. Artifacts without a
+// checksum cannot be addressed and fall back to a direct fetch.
+func (l *Launcher) stageArtifact(ctx context.Context, src, dst, checksum string, writable bool) error {
+	sum := normalizeChecksum(checksum)
+	if sum == "" {
+		return streamFile(ctx, src, dst, checksum)
+	}
+	object, err := l.ensureCached(ctx, src, sum)
+	if err != nil {
+		return err
+	}
+	return materializeArtifact(object, dst, writable)
+}
+
+// sharedArtifact returns the cache object itself for read-only
+// attachment shared across VMs. A checksum is mandatory: without one
+// there is no stable identity to share under.
+func (l *Launcher) sharedArtifact(ctx context.Context, src, checksum string) (string, error) {
+	sum := normalizeChecksum(checksum)
+	if sum == "" {
+		return "", fmt.Errorf("shared artifacts require a sha256 checksum")
+	}
+	return l.ensureCached(ctx, src, sum)
+}
+
+// ensureCached returns the path of the verified cache object for sum,
+// fetching it if absent. Concurrent requests for the same object wait
+// on a single download.
+func (l *Launcher) ensureCached(ctx context.Context, src, sum string) (string, error) {
+	dir := filepath.Join(l.RuntimeDir, "cache", "sha256")
+	object := filepath.Join(dir, sum)
+
+	for {
+		if _, err := os.Stat(object); err == nil {
+			return object, nil
+		}
+
+		l.fetchMu.Lock()
+		if l.fetching == nil {
+			l.fetching = make(map[string]chan struct{})
+		}
+		waiter, inflight := l.fetching[sum]
+		if !inflight {
+			waiter = make(chan struct{})
+			l.fetching[sum] = waiter
+		}
+		l.fetchMu.Unlock()
+
+		if inflight {
+			select {
+			case <-waiter:
+				continue
+			case <-ctx.Done():
+				return "", ctx.Err()
+			}
+		}
+
+		err := l.fetchObject(ctx, src, sum, dir, object)
+		l.fetchMu.Lock()
+		delete(l.fetching, sum)
+		l.fetchMu.Unlock()
+		close(waiter)
+		if err != nil {
+			return "", err
+		}
+		return object, nil
+	}
+}
+
+// fetchObject downloads or copies src into the cache under its
+// checksum, verifying the digest before the object becomes visible.
+func (l *Launcher) fetchObject(ctx context.Context, src, sum, dir, object string) error {
+	if err := os.MkdirAll(dir, 0o755); err != nil {
+		return fmt.Errorf("cloudhypervisor: ensure cache dir: %w", err)
+	}
+	tmp, err := os.CreateTemp(dir, "fetch-*")
+	if err != nil {
+		return fmt.Errorf("cloudhypervisor: create cache temp: %w", err)
+	}
+	tmpPath := tmp.Name()
+	cleanup := func() {
+		tmp.Close()
+		os.Remove(tmpPath)
+	}
+
+	if strings.HasPrefix(src, "http://") || strings.HasPrefix(src, "https://") {
+		size, ranged := probeRangeSupport(ctx, src)
+		if ranged && size >= chunkedThreshold {
+			err = downloadChunked(ctx, src, tmp, size)
+		} else {
+			err = downloadSingle(ctx, src, tmp)
+		}
+	} else {
+		var in *os.File
+		in, err = os.Open(src)
+		if err == nil {
+			_, err = io.Copy(tmp, in)
+			in.Close()
+		}
+	}
+	if err != nil {
+		cleanup()
+		return err
+	}
+
+	actual, err := hashFile(tmpPath)
+	if err != nil {
+		cleanup()
+		return err
+	}
+	if !strings.EqualFold(actual, sum) {
+		cleanup()
+		return fmt.Errorf("checksum mismatch: expected %s got %s", sum, actual)
+	}
+	if err := tmp.Close(); err != nil {
+		os.Remove(tmpPath)
+		return err
+	}
+	if err := os.Rename(tmpPath, object); err != nil {
+		os.Remove(tmpPath)
+		return fmt.Errorf("cloudhypervisor: commit cache object: %w", err)
+	}
+	return nil
+}
+
+// probeRangeSupport asks the origin whether ranged requests are
+// honoured and how large the artifact is.
+func probeRangeSupport(ctx context.Context, src string) (int64, bool) {
+	req, err := http.NewRequestWithContext(ctx, http.MethodHead, src, nil)
+	if err != nil {
+		return 0, false
+	}
+	resp, err := http.DefaultClient.Do(req)
+	if err != nil {
+		return 0, false
+	}
+	defer resp.Body.Close()
+	if resp.StatusCode >= 300 || resp.ContentLength <= 0 {
+		return 0, false
+	}
+	return resp.ContentLength, strings.EqualFold(resp.Header.Get("Accept-Ranges"), "bytes")
+}
+
+func downloadSingle(ctx context.Context, src string, out *os.File) error {
+	req, err := http.NewRequestWithContext(ctx, http.MethodGet, src, nil)
+	if err != nil {
+		return err
+	}
+	resp, err := http.DefaultClient.Do(req)
+	if err != nil {
+		return err
+	}
+	defer resp.Body.Close()
+	if resp.StatusCode >= 300 {
+		return fmt.Errorf("download %s: status %s", src, resp.Status)
+	}
+	_, err = io.Copy(out, resp.Body)
+	return err
+}
+
+// downloadChunked fetches the artifact with parallel ranged requests,
+// each writing its slice directly at the right offset.
+func downloadChunked(ctx context.Context, src string, out *os.File, size int64) error {
+	if err := out.Truncate(size); err != nil {
+		return err
+	}
+	ctx, cancel := context.WithCancel(ctx)
+	defer cancel()
+
+	part := (size + downloadParts - 1) / downloadParts
+	errs := make(chan error, downloadParts)
+	var wg sync.WaitGroup
+	for i := int64(0); i < downloadParts; i++ {
+		start := i * part
+		if start >= size {
+			break
+		}
+		end := start + part - 1
+		if end >= size {
+			end = size - 1
+		}
+		wg.Add(1)
+		go func(start, end int64) {
+			defer wg.Done()
+			if err := downloadRange(ctx, src, out, start, end); err != nil {
+				errs <- err
+				cancel()
+			}
+		}(start, end)
+	}
+	wg.Wait()
+	select {
+	case err := <-errs:
+		return err
+	default:
+		return nil
+	}
+}
+
+func downloadRange(ctx context.Context, src string, out *os.File, start, end int64) error {
+	req, err := http.NewRequestWithContext(ctx, http.MethodGet, src, nil)
+	if err != nil {
+		return err
+	}
+	req.Header.Set("Range", fmt.Sprintf("bytes=%d-%d", start, end))
+	resp, err := http.DefaultClient.Do(req)
+	if err != nil {
+		return err
+	}
+	defer resp.Body.Close()
+	if resp.StatusCode != http.StatusPartialContent {
+		return fmt.Errorf("download %s: status %s for range %d-%d", src, resp.Status, start, end)
+	}
+	_, err = io.Copy(io.NewOffsetWriter(out, start), resp.Body)
+	return err
+}
+
+// materializeArtifact produces dst from a cache object, cheapest
+// mechanism first: reflink shares extents copy-on-write, hardlinks are
+// only safe when the consumer never writes, and a byte copy is the
+// fallback.
+func materializeArtifact(object, dst string, writable bool) error {
+	_ = os.Remove(dst)
+	if err := cloneFile(object, dst); err == nil {
+		return nil
+	}
+	if !writable {
+		if err := os.Link(object, dst); err == nil {
+			return nil
+		}
+	}
+	return copyFile(object, dst)
+}
+
+func hashFile(path string) (string, error) {
+	file, err := os.Open(path)
+	if err != nil {
+		return "", err
+	}
+	defer file.Close()
+	hasher := sha256.New()
+	if _, err := io.Copy(hasher, file); err != nil {
+		return "", err
+	}
+	return hex.EncodeToString(hasher.Sum(nil)), nil
+}
+
+// normalizeChecksum reduces a manifest checksum to bare lowercase hex,
+// returning empty when it is not a usable sha256 digest.
+func normalizeChecksum(checksum string) string {
+	sum := strings.ToLower(strings.TrimPrefix(strings.TrimSpace(checksum), "sha256:"))
+	if len(sum) != sha256.Size*2 {
+		return ""
+	}
+	if _, err := hex.DecodeString(sum); err != nil {
+		return ""
+	}
+	return sum
+}
@@ -16,6 +16,7 @@ import (
 	"os/exec"
 	"path/filepath"
 	"strings"
+	"sync"
 	"syscall"
 	"time"
 
@@ -31,6 +32,10 @@ type Launcher struct {
 	RuntimeDir  string
 	LogDir      string
 	ConsoleDir  string
+
+	// fetching de-duplicates concurrent cache downloads per checksum.
+	fetchMu  sync.Mutex
+	fetching map[string]chan struct{}
 }
 
 // New returns a configured Launcher.
@@ -88,21 +93,36 @@ func (l *Launcher) Launch(ctx context.Context, spec runtime.LaunchSpec) (runtime
 	var initramfsCopy string
 	if strings.TrimSpace(spec.Initramfs) != "" {
 		initramfsCopy = filepath.Join(l.RuntimeDir, fmt.Sprintf("%s.initramfs", spec.Name))
-		if err := streamFile(ctx, spec.Initramfs, initramfsCopy, spec.InitramfsChecksum); err != nil {
+		if err := l.stageArtifact(ctx, spec.Initramfs, initramfsCopy, spec.InitramfsChecksum, false); err != nil {
 			_ = os.Remove(kernelCopy)
 			return nil, fmt.Errorf("cloudhypervisor: stage initramfs: %w", err)
 		}
 	}
 
 	var rootfsPath string
+	var sharedRootFS string
 	if spec.RootFS != "" {
-		rootfsPath = filepath.Join(l.RuntimeDir, fmt.Sprintf("%s.rootfs", spec.Name))
-		if err := streamFile(ctx, spec.RootFS, rootfsPath, spec.RootFSChecksum); err != nil {
-			_ = os.Remove(kernelCopy)
-			if initramfsCopy != "" {
-				_ = os.Remove(initramfsCopy)
+		if spec.RootFSShared {
+			// All replicas map the same cache object, so the image
+			// occupies page cache once per host instead of per VM.
+			shared, err := l.sharedArtifact(ctx, spec.RootFS, spec.RootFSChecksum)
+			if err != nil {
+				_ = os.Remove(kernelCopy)
+				if initramfsCopy != "" {
+					_ = os.Remove(initramfsCopy)
+				}
+				return nil, fmt.Errorf("cloudhypervisor: shared rootfs: %w", err)
+			}
+			sharedRootFS = shared
+		} else {
+			rootfsPath = filepath.Join(l.RuntimeDir, fmt.Sprintf("%s.rootfs", spec.Name))
+			if err := l.stageArtifact(ctx, spec.RootFS, rootfsPath, spec.RootFSChecksum, true); err != nil {
+				_ = os.Remove(kernelCopy)
+				if initramfsCopy != "" {
+					_ = os.Remove(initramfsCopy)
+				}
+				return nil, fmt.Errorf("cloudhypervisor: fetch rootfs: %w", err)
 			}
-			return nil, fmt.Errorf("cloudhypervisor: fetch rootfs: %w", err)
 		}
 	}
 
@@ -177,7 +197,9 @@ func (l *Launcher) Launch(ctx context.Context, spec runtime.LaunchSpec) (runtime
 	if initramfsCopy != "" {
 		args = append(args, "--initramfs", initramfsCopy)
 	}
-	if rootfsPath != "" {
+	if sharedRootFS != "" {
+		args = append(args, "--pmem", fmt.Sprintf("file=%s,discard_writes=on", sharedRootFS))
+	} else if rootfsPath != "" {
 		args = append(args, "--disk", fmt.Sprintf("path=%s,readonly=false", rootfsPath))
 	}
 	for _, disk := range spec.Disks {
@@ -273,13 +295,7 @@ func (l *Launcher) Launch(ctx context.Context, spec runtime.LaunchSpec) (runtime
 	}
 
 	done := make(chan error, 1)
-	go func() {
-		err := cmd.Wait()
-		done <- err
-		close(done)
-	}()
-
-	return &instance{
+	inst := &instance{
 		name:          spec.Name,
 		cmd:           cmd,
 		apiSocket:     apiSocket,
@@ -290,7 +306,26 @@ func (l *Launcher) Launch(ctx context.Context, spec runtime.LaunchSpec) (runtime
 		kernelPath:    kernelCopy,
 		initramfsPath: initramfsCopy,
 		rootfsPath:    rootfsPath,
-	}, nil
+	}
+	inst.superviseWait()
+
+	return inst, nil
+}
+
+// superviseWait reaps the hypervisor process on exit. On Linux the
+// shared pidfd/epoll reactor fires the reap, so no goroutine sits
+// parked in cmd.Wait per running VM; elsewhere (or when pidfd is
+// unavailable) a blocking wait goroutine is the fallback.
+func (i *instance) superviseWait() {
+	wait := func() {
+		err := i.cmd.Wait()
+		i.done <- err
+		close(i.done)
+		i.deliverExit(err)
+	}
+	if !watchExit(i.cmd.Process.Pid, wait) {
+		go wait()
+	}
 }
 
 type instance struct {
@@ -300,10 +335,44 @@ type instance struct {
 	serialPath    string
 	consolePath   string
 	logFile       *os.File
-	done          <-chan error
+	done          chan error
 	kernelPath    string
 	initramfsPath string
 	rootfsPath    string
+	// preserveArtifacts keeps staged boot files past Stop because a
+	// snapshot references them by path.
+	preserveArtifacts bool
+	exitMu            sync.Mutex
+	exitFn            func(error)
+	exited            bool
+	exitErr           error
+}
+
+// OnExit registers fn to run once the hypervisor process exits, letting
+// the orchestrator supervise instances without blocking on Wait. If the
+// process already exited, fn fires immediately.
+func (i *instance) OnExit(fn func(error)) {
+	i.exitMu.Lock()
+	if i.exited {
+		err := i.exitErr
+		i.exitMu.Unlock()
+		go fn(err)
+		return
+	}
+	i.exitFn = fn
+	i.exitMu.Unlock()
+}
+
+func (i *instance) deliverExit(err error) {
+	i.exitMu.Lock()
+	i.exited = true
+	i.exitErr = err
+	fn := i.exitFn
+	i.exitFn = nil
+	i.exitMu.Unlock()
+	if fn != nil {
+		go fn(err)
+	}
 }
 
 func (i *instance) Name() string          { return i.name }
@@ -339,7 +408,9 @@ func (i *instance) Stop(ctx context.Context) error {
 	}
 
 	_ = os.Remove(i.apiSocket)
-	i.cleanupArtifacts()
+	if !i.preserveArtifacts {
+		i.cleanupArtifacts()
+	}
 	return nil
 }
 
@@ -0,0 +1,87 @@
+// Copyright (c) 2025 HYPR. PTE. LTD.
+//
+// Business Source License 1.1
+// See LICENSE file in the project root for details.
+
+//go:build linux
+
+package cloudhypervisor
+
+import (
+	"sync"
+
+	"golang.org/x/sys/unix"
+)
+
+// exitReaper watches every hypervisor child through a single epoll fd
+// over pidfds instead of parking one goroutine in cmd.Wait per VM. One
+// reactor loop wakes when a child exits and dispatches the reap, so
+// supervision cost stays flat as VM density grows.
+type exitReaper struct {
+	mu       sync.Mutex
+	epollFD  int
+	handlers map[int32]func()
+	started  bool
+}
+
+var reaper exitReaper
+
+// watchExit arranges for reap to run once pid exits. It returns false
+// when pidfd or epoll are unavailable (old kernel); the caller then
+// falls back to a blocking wait goroutine.
+func watchExit(pid int, reap func()) bool {
+	pidfd, err := unix.PidfdOpen(pid, 0)
+	if err != nil {
+		return false
+	}
+
+	reaper.mu.Lock()
+	defer reaper.mu.Unlock()
+	if !reaper.started {
+		epollFD, err := unix.EpollCreate1(unix.EPOLL_CLOEXEC)
+		if err != nil {
+			unix.Close(pidfd)
+			return false
+		}
+		reaper.epollFD = epollFD
+		reaper.handlers = make(map[int32]func())
+		reaper.started = true
+		go reaper.loop()
+	}
+
+	event := unix.EpollEvent{Events: unix.EPOLLIN, Fd: int32(pidfd)}
+	if err := unix.EpollCtl(reaper.epollFD, unix.EPOLL_CTL_ADD, pidfd, &event); err != nil {
+		unix.Close(pidfd)
+		return false
+	}
+	reaper.handlers[int32(pidfd)] = reap
+	return true
+}
+
+func (r *exitReaper) loop() {
+	events := make([]unix.EpollEvent, 64)
+	for {
+		n, err := unix.EpollWait(r.epollFD, events, -1)
+		if err != nil {
+			if err == unix.EINTR {
+				continue
+			}
+			return
+		}
+		for i := 0; i < n; i++ {
+			fd := events[i].Fd
+			r.mu.Lock()
+			reap := r.handlers[fd]
+			delete(r.handlers, fd)
+			r.mu.Unlock()
+			_ = unix.EpollCtl(r.epollFD, unix.EPOLL_CTL_DEL, int(fd), nil)
+			unix.Close(int(fd))
+			if reap != nil {
+				// The child has exited, so the reap's cmd.Wait returns
+				// immediately; run it off the reactor loop so one slow
+				// dispatch cannot delay other exits.
+				go reap()
+			}
+		}
+	}
+}
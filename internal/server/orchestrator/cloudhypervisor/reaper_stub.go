@@ -0,0 +1,15 @@
+// Copyright (c) 2025 HYPR. PTE. LTD.
+//
+// Business Source License 1.1
+// See LICENSE file in the project root for details.
+
+//go:build !linux
+
+package cloudhypervisor
+
+// watchExit reports that pidfd-based supervision is unavailable; the
+// caller falls back to a blocking wait goroutine. The real
+// implementation lives in reaper_linux.go.
+func watchExit(pid int, reap func()) bool {
+	return false
+}
@@ -0,0 +1,16 @@
+// Copyright (c) 2025 HYPR. PTE. LTD.
+//
+// Business Source License 1.1
+// See LICENSE file in the project root for details.
+
+//go:build !linux
+
+package cloudhypervisor
+
+import "errors"
+
+// cloneFile is unsupported off Linux; callers fall back to hardlinks
+// or byte copies.
+func cloneFile(src, dst string) error {
+	return errors.New("reflink not supported on this platform")
+}
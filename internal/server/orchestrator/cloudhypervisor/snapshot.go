@@ -0,0 +1,153 @@
+// Copyright (c) 2025 HYPR. PTE. LTD.
+//
+// Business Source License 1.1
+// See LICENSE file in the project root for details.
+
+package cloudhypervisor
+
+import (
+	"bytes"
+	"context"
+	"encoding/json"
+	"fmt"
+	"io"
+	"net"
+	"net/http"
+	"os"
+	"os/exec"
+	"path/filepath"
+	"time"
+
+	"github.com/volantvm/volant/internal/server/orchestrator/runtime"
+)
+
+var _ runtime.Snapshotter = (*Launcher)(nil)
+
+// Snapshot captures a running instance's full state (device config plus
+// guest memory) into destDir via the Cloud Hypervisor API socket. The
+// VM is paused for the duration of the capture and resumed afterwards.
+// Staged boot artifacts (kernel, rootfs, initramfs) are preserved past
+// the next Stop because the snapshot references them by path.
+func (l *Launcher) Snapshot(ctx context.Context, inst runtime.Instance, destDir string) error {
+	native, ok := inst.(*instance)
+	if !ok {
+		return fmt.Errorf("cloudhypervisor: snapshot requires a cloud-hypervisor instance")
+	}
+	if err := os.MkdirAll(destDir, 0o755); err != nil {
+		return fmt.Errorf("cloudhypervisor: ensure snapshot dir: %w", err)
+	}
+
+	client := apiSocketClient(native.apiSocket)
+	if err := vmAction(ctx, client, "vm.pause", nil); err != nil {
+		return fmt.Errorf("cloudhypervisor: pause for snapshot: %w", err)
+	}
+	payload := map[string]string{"destination_url": "file://" + destDir}
+	snapErr := vmAction(ctx, client, "vm.snapshot", payload)
+	if resumeErr := vmAction(ctx, client, "vm.resume", nil); resumeErr != nil && snapErr == nil {
+		snapErr = fmt.Errorf("cloudhypervisor: resume after snapshot: %w", resumeErr)
+	}
+	if snapErr != nil {
+		return fmt.Errorf("cloudhypervisor: snapshot: %w", snapErr)
+	}
+
+	native.preserveArtifacts = true
+	return nil
+}
+
+// Restore boots a new instance from a previously captured snapshot.
+// Host-side resources referenced by the snapshot — the tap device, the
+// serial socket path, and the staged boot artifacts — must match the
+// original launch; the caller recreates the tap before restoring.
+func (l *Launcher) Restore(ctx context.Context, spec runtime.LaunchSpec, snapshotDir string) (runtime.Instance, error) {
+	if l.Binary == "" {
+		return nil, fmt.Errorf("cloudhypervisor: binary path required")
+	}
+	if _, err := os.Stat(filepath.Join(snapshotDir, "config.json")); err != nil {
+		return nil, fmt.Errorf("cloudhypervisor: snapshot config: %w", err)
+	}
+
+	apiSocket := filepath.Join(l.RuntimeDir, fmt.Sprintf("%s.sock", spec.Name))
+	_ = os.Remove(apiSocket)
+	if spec.SerialSocket != "" {
+		if err := removeIfExists(spec.SerialSocket); err != nil {
+			return nil, fmt.Errorf("cloudhypervisor: prepare serial socket: %w", err)
+		}
+	}
+
+	if l.LogDir == "" {
+		l.LogDir = l.RuntimeDir
+	}
+	logPath := filepath.Join(l.LogDir, fmt.Sprintf("%s.log", spec.Name))
+	logFile, err := os.OpenFile(logPath, os.O_CREATE|os.O_WRONLY|os.O_APPEND, 0o644)
+	if err != nil {
+		return nil, fmt.Errorf("cloudhypervisor: open log file: %w", err)
+	}
+
+	args := []string{
+		"--api-socket", fmt.Sprintf("path=%s", apiSocket),
+		"--restore", fmt.Sprintf("source_url=file://%s", snapshotDir),
+	}
+
+	cmd := exec.CommandContext(ctx, l.Binary, args...)
+	cmd.Stdout = logFile
+	cmd.Stderr = logFile
+	if err := cmd.Start(); err != nil {
+		_ = logFile.Close()
+		return nil, fmt.Errorf("cloudhypervisor: restore: %w", err)
+	}
+
+	inst := &instance{
+		name:       spec.Name,
+		cmd:        cmd,
+		apiSocket:  apiSocket,
+		serialPath: spec.SerialSocket,
+		logFile:    logFile,
+		done:       make(chan error, 1),
+	}
+	inst.superviseWait()
+
+	return inst, nil
+}
+
+// apiSocketClient returns an HTTP client dialing the hypervisor's unix
+// API socket.
+func apiSocketClient(socket string) *http.Client {
+	return &http.Client{
+		Timeout: 60 * time.Second,
+		Transport: &http.Transport{
+			DialContext: func(ctx context.Context, _, _ string) (net.Conn, error) {
+				var d net.Dialer
+				return d.DialContext(ctx, "unix", socket)
+			},
+		},
+	}
+}
+
+// vmAction issues a PUT against the Cloud Hypervisor REST API.
+func vmAction(ctx context.Context, client *http.Client, action string, payload any) error {
+	var body io.Reader
+	if payload != nil {
+		encoded, err := json.Marshal(payload)
+		if err != nil {
+			return err
+		}
+		body = bytes.NewReader(encoded)
+	}
+	req, err := http.NewRequestWithContext(ctx, http.MethodPut, "http://localhost/api/v1/"+action, body)
+	if err != nil {
+		return err
+	}
+	if payload != nil {
+		req.Header.Set("Content-Type", "application/json")
+	}
+	resp, err := client.Do(req)
+	if err != nil {
+		return err
+	}
+	defer resp.Body.Close()
+	if resp.StatusCode < 200 || resp.StatusCode >= 300 {
+		detail, _ := io.ReadAll(io.LimitReader(resp.Body, 4096))
+		return fmt.Errorf("%s returned status %d: %s", action, resp.StatusCode, bytes.TrimSpace(detail))
+	}
+	return nil
+}
@@ -7,12 +7,16 @@ package cloudinit
 
 import (
 	"context"
+	"crypto/sha256"
+	"encoding/hex"
 	"fmt"
 	"io"
 	"os"
 	"os/exec"
 	"path/filepath"
 	"strings"
+	"sync"
+	"time"
 
 	diskfs "github.com/diskfs/go-diskfs"
 	diskpkg "github.com/diskfs/go-diskfs/disk"
@@ -30,6 +34,43 @@ type SeedInput struct {
 	NetworkConfig string
 }
 
+// resolveDocuments applies the defaulting Build writes into the image,
+// so content hashing and building agree byte for byte.
+func resolveDocuments(input SeedInput) (userData, metaData, networkConfig string) {
+	userData = strings.TrimSpace(input.UserData)
+	if userData == "" {
+		userData = "#cloud-config\n"
+	}
+
+	metaData = strings.TrimSpace(input.MetaData)
+	if metaData == "" {
+		instID := strings.TrimSpace(input.InstanceID)
+		if instID == "" {
+			instID = "volant-instance"
+		}
+		hostname := strings.TrimSpace(input.Hostname)
+		if hostname == "" {
+			hostname = instID
+		}
+		metaData = fmt.Sprintf("instance-id: %s\nlocal-hostname: %s\n", instID, hostname)
+	}
+
+	networkConfig = strings.TrimSpace(input.NetworkConfig)
+	return userData, metaData, networkConfig
+}
+
+// contentHash keys the seed cache by the resolved documents, so two
+// inputs that produce byte-identical images share one cache entry.
+func (input SeedInput) contentHash() string {
+	userData, metaData, networkConfig := resolveDocuments(input)
+	h := sha256.New()
+	for _, doc := range []string{userData, metaData, networkConfig} {
+		fmt.Fprintf(h, "%d:", len(doc))
+		h.Write([]byte(doc))
+	}
+	return hex.EncodeToString(h.Sum(nil))
+}
+
 // Build creates a cloud-init seed image at dest using either cloud-localds or genisoimage/mkisofs.
 func Build(ctx context.Context, input SeedInput, dest string) error {
 	if strings.TrimSpace(dest) == "" {
@@ -45,34 +86,18 @@ func Build(ctx context.Context, input SeedInput, dest string) error {
 	}
 	defer os.RemoveAll(tmpDir)
 
-	userData := strings.TrimSpace(input.UserData)
-	if userData == "" {
-		userData = "#cloud-config\n"
-	}
+	userData, metaData, networkConfig := resolveDocuments(input)
 	if err := os.WriteFile(filepath.Join(tmpDir, "user-data"), []byte(userData), 0o644); err != nil {
 		return fmt.Errorf("cloudinit: write user-data: %w", err)
 	}
-
-	metaData := strings.TrimSpace(input.MetaData)
-	if metaData == "" {
-		instID := strings.TrimSpace(input.InstanceID)
-		if instID == "" {
-			instID = "volant-instance"
-		}
-		hostname := strings.TrimSpace(input.Hostname)
-		if hostname == "" {
-			hostname = instID
-		}
-		metaData = fmt.Sprintf("instance-id: %s\nlocal-hostname: %s\n", instID, hostname)
-	}
 	if err := os.WriteFile(filepath.Join(tmpDir, "meta-data"), []byte(metaData), 0o644); err != nil {
 		return fmt.Errorf("cloudinit: write meta-data: %w", err)
 	}
 
 	networkPath := ""
-	if strings.TrimSpace(input.NetworkConfig) != "" {
+	if networkConfig != "" {
 		networkPath = filepath.Join(tmpDir, "network-config")
-		if err := os.WriteFile(networkPath, []byte(input.NetworkConfig), 0o644); err != nil {
+		if err := os.WriteFile(networkPath, []byte(networkConfig), 0o644); err != nil {
 			return fmt.Errorf("cloudinit: write network-config: %w", err)
 		}
 	}
@@ -86,12 +111,130 @@ func Build(ctx context.Context, input SeedInput, dest string) error {
 		"user-data": []byte(userData),
 		"meta-data": []byte(metaData),
 	}
-	if strings.TrimSpace(input.NetworkConfig) != "" {
-		files["network-config"] = []byte(input.NetworkConfig)
+	if networkConfig != "" {
+		files["network-config"] = []byte(networkConfig)
 	}
 	return buildVFAT(dest, files)
 }
 
+// cacheEntryMaxAge bounds how long unused cache entries linger before a
+// miss sweeps them out.
+const cacheEntryMaxAge = 30 * 24 * time.Hour
+
+var (
+	cacheMu    sync.Mutex
+	cacheLocks = make(map[string]*sync.Mutex)
+)
+
+// cacheLock serializes builds of one cache key so concurrent starts of
+// VMs with identical seed content build the image once.
+func cacheLock(key string) *sync.Mutex {
+	cacheMu.Lock()
+	defer cacheMu.Unlock()
+	lock, ok := cacheLocks[key]
+	if !ok {
+		lock = &sync.Mutex{}
+		cacheLocks[key] = lock
+	}
+	return lock
+}
+
+// BuildCached is Build behind a content-addressed cache: the image for a
+// given document set is built once under cacheDir and reused via
+// hardlink (falling back to copy across filesystems) on later calls, so
+// VM restarts skip the fork+exec and temp-dir I/O entirely.
+func BuildCached(ctx context.Context, input SeedInput, cacheDir, dest string) error {
+	if strings.TrimSpace(cacheDir) == "" {
+		return Build(ctx, input, dest)
+	}
+	if strings.TrimSpace(dest) == "" {
+		return fmt.Errorf("cloudinit: destination path required")
+	}
+	if err := os.MkdirAll(cacheDir, 0o755); err != nil {
+		return fmt.Errorf("cloudinit: ensure cache directory: %w", err)
+	}
+
+	key := input.contentHash()
+	cached := filepath.Join(cacheDir, key+".img")
+
+	lock := cacheLock(key)
+	lock.Lock()
+	defer lock.Unlock()
+
+	if _, err := os.Stat(cached); err != nil {
+		if !os.IsNotExist(err) {
+			return fmt.Errorf("cloudinit: stat cached seed: %w", err)
+		}
+		pruneStaleSeeds(cacheDir)
+		tmp := cached + ".tmp"
+		if err := Build(ctx, input, tmp); err != nil {
+			_ = os.Remove(tmp)
+			return err
+		}
+		if err := os.Rename(tmp, cached); err != nil {
+			_ = os.Remove(tmp)
+			return fmt.Errorf("cloudinit: publish cached seed: %w", err)
+		}
+	} else {
+		now := time.Now()
+		_ = os.Chtimes(cached, now, now)
+	}
+
+	return linkOrCopy(cached, dest)
+}
+
+// pruneStaleSeeds drops cache entries that have not been reused within
+// cacheEntryMaxAge. Best-effort: failures just leave entries behind.
+func pruneStaleSeeds(cacheDir string) {
+	entries, err := os.ReadDir(cacheDir)
+	if err != nil {
+		return
+	}
+	cutoff := time.Now().Add(-cacheEntryMaxAge)
+	for _, entry := range entries {
+		if entry.IsDir() || !strings.HasSuffix(entry.Name(), ".img") {
+			continue
+		}
+		info, err := entry.Info()
+		if err != nil {
+			continue
+		}
+		if info.ModTime().Before(cutoff) {
+			_ = os.Remove(filepath.Join(cacheDir, entry.Name()))
+		}
+	}
+}
+
+// linkOrCopy materializes dest from the cached image, preferring a
+// hardlink (seed disks attach read-only, so sharing the inode is safe)
+// and copying when the link fails, e.g. across filesystems.
+func linkOrCopy(src, dest string) error {
+	if err := os.MkdirAll(filepath.Dir(dest), 0o755); err != nil {
+		return fmt.Errorf("cloudinit: ensure destination directory: %w", err)
+	}
+	if err := os.Remove(dest); err != nil && !os.IsNotExist(err) {
+		return fmt.Errorf("cloudinit: replace destination: %w", err)
+	}
+	if err := os.Link(src, dest); err == nil {
+		return nil
+	}
+
+	in, err := os.Open(src)
+	if err != nil {
+		return fmt.Errorf("cloudinit: open cached seed: %w", err)
+	}
+	defer in.Close()
+	out, err := os.OpenFile(dest, os.O_CREATE|os.O_WRONLY|os.O_TRUNC, 0o644)
+	if err != nil {
+		return fmt.Errorf("cloudinit: create destination: %w", err)
+	}
+	if _, err := io.Copy(out, in); err != nil {
+		_ = out.Close()
+		return fmt.Errorf("cloudinit: copy cached seed: %w", err)
+	}
+	return out.Close()
+}
+
 func runCloudLocalDS(ctx context.Context, dest, tmpDir, networkPath string) error {
 	args := []string{}
 	if networkPath != "" {
@@ -34,12 +34,14 @@ type VMEvent struct {
 }
 
 const (
-	TypeVMCreated = "VM_CREATED"
-	TypeVMRunning = "VM_RUNNING"
-	TypeVMStopped = "VM_STOPPED"
-	TypeVMCrashed = "VM_CRASHED"
-	TypeVMDeleted = "VM_DELETED"
-	TypeVMLog     = "VM_LOG"
+	TypeVMCreated   = "VM_CREATED"
+	TypeVMRunning   = "VM_RUNNING"
+	TypeVMStopped   = "VM_STOPPED"
+	TypeVMCrashed   = "VM_CRASHED"
+	TypeVMDeleted   = "VM_DELETED"
+	TypeVMLog       = "VM_LOG"
+	TypeVMReady     = "VM_READY"
+	TypeVMUnhealthy = "VM_UNHEALTHY"
 )
 
 // Canonical stream identifiers used when VMEvent.Type is TypeVMLog.
@@ -0,0 +1,210 @@
+// Copyright (c) 2025 HYPR. PTE. LTD.
+//
+// Business Source License 1.1
+// See LICENSE file in the project root for details.
+
+package orchestrator
+
+import (
+	"encoding/binary"
+	"fmt"
+	"math/bits"
+	"net"
+	"sync"
+
+	"github.com/volantvm/volant/internal/server/db"
+)
+
+// ipAllocator hands out host addresses from the managed subnet. It
+// tracks occupancy in a bitmap (one bit per address) and derives each
+// address from its offset on demand, so a /16 costs 8 KiB instead of
+// 65k strings materialized at startup. Allocation scans whole words
+// from a rotating hint and release clears a bit, so both stay cheap no
+// matter how large the subnet is.
+type ipAllocator struct {
+	mu    sync.Mutex
+	base  uint32 // network address of the subnet
+	total uint32 // addresses in the subnet, including network/broadcast
+	host  uint32 // offset of the host's own address, or total if outside
+	words []uint64
+	hint  uint32 // word index where the next scan starts
+	free  uint32 // assignable addresses currently free
+}
+
+func newIPAllocator(subnet *net.IPNet, hostIP net.IP) (*ipAllocator, error) {
+	ipv4 := subnet.IP.To4()
+	if ipv4 == nil {
+		return nil, fmt.Errorf("ipv6 subnets are not supported: %s", subnet)
+	}
+
+	ones, bitCount := subnet.Mask.Size()
+	hostBits := bitCount - ones
+	if hostBits <= 0 {
+		return nil, fmt.Errorf("invalid subnet mask: %s", subnet.Mask)
+	}
+
+	total := uint32(1) << hostBits
+	a := &ipAllocator{
+		base:  binary.BigEndian.Uint32(ipv4.Mask(subnet.Mask)),
+		total: total,
+		host:  total,
+		words: make([]uint64, (total+63)/64),
+		free:  total,
+	}
+
+	// Reserve the network and broadcast addresses, the host's own
+	// address, and the padding bits beyond the subnet in the last word.
+	a.reserve(0)
+	a.reserve(total - 1)
+	if host := hostIP.To4(); host != nil {
+		if offset := binary.BigEndian.Uint32(host) - a.base; offset < total {
+			a.host = offset
+			a.reserve(offset)
+		}
+	}
+	for offset := total; offset < uint32(len(a.words))*64; offset++ {
+		a.words[offset/64] |= 1 << (offset % 64)
+	}
+
+	if a.free == 0 {
+		return nil, fmt.Errorf("no assignable IPs in subnet %s", subnet)
+	}
+	return a, nil
+}
+
+func (a *ipAllocator) reserve(offset uint32) {
+	word, bit := offset/64, uint64(1)<<(offset%64)
+	if a.words[word]&bit == 0 {
+		a.words[word] |= bit
+		a.free--
+	}
+}
+
+// markUsed seeds an address known to be in use (from the VM table or a
+// surviving lease) into the bitmap. Addresses outside the subnet are
+// ignored.
+func (a *ipAllocator) markUsed(ip string) {
+	offset, ok := a.offsetOf(ip)
+	if !ok {
+		return
+	}
+	a.mu.Lock()
+	a.reserve(offset)
+	a.mu.Unlock()
+}
+
+// allocate returns a free address and marks it used.
+func (a *ipAllocator) allocate() (string, error) {
+	a.mu.Lock()
+	defer a.mu.Unlock()
+	if a.free == 0 {
+		return "", db.ErrNoAvailableIPs
+	}
+	words := uint32(len(a.words))
+	for i := uint32(0); i < words; i++ {
+		idx := (a.hint + i) % words
+		word := a.words[idx]
+		if word == ^uint64(0) {
+			continue
+		}
+		bit := uint32(bits.TrailingZeros64(^word))
+		offset := idx*64 + bit
+		a.words[idx] |= 1 << bit
+		a.free--
+		a.hint = idx
+		addr := make(net.IP, net.IPv4len)
+		binary.BigEndian.PutUint32(addr, a.base+offset)
+		return addr.String(), nil
+	}
+	return "", db.ErrNoAvailableIPs
+}
+
+// release returns an address to the pool. Unknown or out-of-subnet
+// addresses are ignored so callers can pass whatever the VM record
+// holds; the permanently reserved network, broadcast, and host
+// addresses are refused so they can never re-enter the pool.
+func (a *ipAllocator) release(ip string) {
+	offset, ok := a.offsetOf(ip)
+	if !ok || offset == 0 || offset == a.total-1 || offset == a.host {
+		return
+	}
+	a.mu.Lock()
+	word, bit := offset/64, uint64(1)<<(offset%64)
+	if a.words[word]&bit != 0 {
+		a.words[word] &^= bit
+		a.free++
+		if word < a.hint {
+			a.hint = word
+		}
+	}
+	a.mu.Unlock()
+}
+
+func (a *ipAllocator) offsetOf(ip string) (uint32, bool) {
+	parsed := net.ParseIP(ip)
+	if parsed == nil {
+		return 0, false
+	}
+	ipv4 := parsed.To4()
+	if ipv4 == nil {
+		return 0, false
+	}
+	offset := binary.BigEndian.Uint32(ipv4) - a.base
+	if offset >= a.total {
+		return 0, false
+	}
+	return offset, true
+}
+
+// cidAllocator hands out vsock CIDs in O(1) from a monotonically
+// growing counter plus a free list of released CIDs, replacing the
+// full VM-table scan that used to run on every create. CIDs 0-2 are
+// reserved: 0=hypervisor, 1=local, 2=host.
+type cidAllocator struct {
+	mu    sync.Mutex
+	next  uint32
+	freed []uint32
+}
+
+// seed positions the counter above every CID already in use. Called
+// once with the CIDs loaded from the VM table.
+func (c *cidAllocator) seed(used []uint32) {
+	c.mu.Lock()
+	if c.next < 3 {
+		c.next = 3
+	}
+	for _, cid := range used {
+		if cid >= c.next {
+			c.next = cid + 1
+		}
+	}
+	c.mu.Unlock()
+}
+
+func (c *cidAllocator) allocate() (uint32, error) {
+	c.mu.Lock()
+	defer c.mu.Unlock()
+	if n := len(c.freed); n > 0 {
+		cid := c.freed[n-1]
+		c.freed = c.freed[:n-1]
+		return cid, nil
+	}
+	if c.next < 3 {
+		c.next = 3
+	}
+	if c.next == ^uint32(0) {
+		return 0, fmt.Errorf("no available vsock CIDs")
+	}
+	cid := c.next
+	c.next++
+	return cid, nil
+}
+
+func (c *cidAllocator) release(cid uint32) {
+	if cid < 3 {
+		return
+	}
+	c.mu.Lock()
+	c.freed = append(c.freed, cid)
+	c.mu.Unlock()
+}
@@ -0,0 +1,132 @@
+// Copyright (c) 2025 HYPR. PTE. LTD.
+//
+// Business Source License 1.1
+// See LICENSE file in the project root for details.
+
+package orchestrator
+
+import (
+	"net"
+	"testing"
+)
+
+func TestIPAllocatorReservesAndRecycles(t *testing.T) {
+	_, subnet, err := net.ParseCIDR("192.168.127.0/29")
+	if err != nil {
+		t.Fatalf("parse cidr: %v", err)
+	}
+	host := net.ParseIP("192.168.127.1")
+
+	alloc, err := newIPAllocator(subnet, host)
+	if err != nil {
+		t.Fatalf("new allocator: %v", err)
+	}
+
+	// /29 has 8 addresses; network, broadcast, and the host are
+	// reserved, leaving 5 assignable.
+	seen := map[string]bool{}
+	for i := 0; i < 5; i++ {
+		ip, err := alloc.allocate()
+		if err != nil {
+			t.Fatalf("allocate %d: %v", i, err)
+		}
+		switch ip {
+		case "192.168.127.0", "192.168.127.1", "192.168.127.7":
+			t.Fatalf("allocated reserved address %s", ip)
+		}
+		if seen[ip] {
+			t.Fatalf("address %s allocated twice", ip)
+		}
+		seen[ip] = true
+	}
+	if _, err := alloc.allocate(); err == nil {
+		t.Fatalf("expected exhaustion error")
+	}
+
+	alloc.release("192.168.127.3")
+	ip, err := alloc.allocate()
+	if err != nil {
+		t.Fatalf("allocate after release: %v", err)
+	}
+	if ip != "192.168.127.3" {
+		t.Fatalf("expected recycled 192.168.127.3, got %s", ip)
+	}
+}
+
+func TestIPAllocatorRefusesReservedRelease(t *testing.T) {
+	_, subnet, err := net.ParseCIDR("192.168.127.0/30")
+	if err != nil {
+		t.Fatalf("parse cidr: %v", err)
+	}
+	alloc, err := newIPAllocator(subnet, net.ParseIP("192.168.127.1"))
+	if err != nil {
+		t.Fatalf("new allocator: %v", err)
+	}
+
+	// Releasing the network, host, or broadcast address must not
+	// return it to the pool.
+	alloc.release("192.168.127.0")
+	alloc.release("192.168.127.1")
+	alloc.release("192.168.127.3")
+
+	// Only .2 is assignable.
+	ip, err := alloc.allocate()
+	if err != nil {
+		t.Fatalf("allocate: %v", err)
+	}
+	if ip != "192.168.127.2" {
+		t.Fatalf("expected 192.168.127.2, got %s", ip)
+	}
+	if _, err := alloc.allocate(); err == nil {
+		t.Fatalf("expected exhaustion after the only assignable address")
+	}
+}
+
+func TestIPAllocatorMarkUsed(t *testing.T) {
+	_, subnet, err := net.ParseCIDR("192.168.127.0/30")
+	if err != nil {
+		t.Fatalf("parse cidr: %v", err)
+	}
+	alloc, err := newIPAllocator(subnet, net.ParseIP("192.168.127.1"))
+	if err != nil {
+		t.Fatalf("new allocator: %v", err)
+	}
+
+	// Only .2 is assignable; seeding it as used exhausts the pool.
+	alloc.markUsed("192.168.127.2")
+	alloc.markUsed("10.0.0.1") // outside the subnet: ignored
+	if _, err := alloc.allocate(); err == nil {
+		t.Fatalf("expected exhaustion after seeding used address")
+	}
+}
+
+func TestCIDAllocator(t *testing.T) {
+	var cids cidAllocator
+	cids.seed([]uint32{3, 7})
+
+	first, err := cids.allocate()
+	if err != nil {
+		t.Fatalf("allocate: %v", err)
+	}
+	if first != 8 {
+		t.Fatalf("expected allocation above seeded max, got %d", first)
+	}
+
+	cids.release(3)
+	recycled, err := cids.allocate()
+	if err != nil {
+		t.Fatalf("allocate recycled: %v", err)
+	}
+	if recycled != 3 {
+		t.Fatalf("expected recycled cid 3, got %d", recycled)
+	}
+
+	cids.release(2) // reserved: ignored
+	next, err := cids.allocate()
+	if err != nil {
+		t.Fatalf("allocate next: %v", err)
+	}
+	if next != 9 {
+		t.Fatalf("expected 9, got %d", next)
+	}
+}
@@ -8,7 +8,6 @@ package orchestrator
 import (
 	"context"
 	"crypto/sha1"
-	"encoding/binary"
 	"encoding/json"
 	"errors"
 	"fmt"
@@ -34,6 +33,7 @@ import (
 	"github.com/volantvm/volant/internal/server/orchestrator/network"
 	"github.com/volantvm/volant/internal/server/orchestrator/runtime"
 	"github.com/volantvm/volant/internal/server/orchestrator/vmconfig"
+	"github.com/volantvm/volant/internal/telemetry"
 )
 
 // Engine represents the VM orchestration core.
@@ -107,6 +107,15 @@ type Params struct {
 	Network          network.Manager
 	Bus              eventbus.Bus
 	Drift            *driftclient.Client
+	// DeployParallelism bounds concurrent replica provisioning during
+	// deployment reconcile; values below one fall back to the default.
+	DeployParallelism int
+	// WarmPoolSize keeps this many pre-booted instances per plugin
+	// configuration for StartVM to claim; zero disables the pool.
+	WarmPoolSize int
+	// VMSnapshots snapshots instances on clean stop and restores them
+	// on the next start when the launcher supports it.
+	VMSnapshots bool
 }
 
 // New constructs the production orchestrator engine.
@@ -145,7 +154,7 @@ func New(params Params) (Engine, error) {
 		return nil, fmt.Errorf("orchestrator: host IP %s not in subnet %s", params.HostIP, params.Subnet)
 	}
 
-	pool, err := deriveIPPool(params.Subnet, params.HostIP)
+	ipam, err := newIPAllocator(params.Subnet, params.HostIP)
 	if err != nil {
 		return nil, fmt.Errorf("orchestrator: derive ip pool: %w", err)
 	}
@@ -172,6 +181,11 @@ func New(params Params) (Engine, error) {
 		}
 		runtimeDir = filepath.Join(home, runtimeDir[2:])
 	}
+	deployParallelism := params.DeployParallelism
+	if deployParallelism < 1 {
+		deployParallelism = 8
+	}
+
 	runtimeDir = filepath.Clean(runtimeDir)
 	if !filepath.IsAbs(runtimeDir) {
 		absRuntime, err := filepath.Abs(runtimeDir)
@@ -189,7 +203,7 @@ func New(params Params) (Engine, error) {
 		controlListenAddr:    listenAddr,
 		controlAdvertiseAddr: advertiseAddr,
 		controlPort:          advertisePort,
-		ipPool:               pool,
+		ipam:                 ipam,
 		runtimeDir:           runtimeDir,
 		launcher:             params.Launcher,
 		network:              params.Network,
@@ -197,6 +211,13 @@ func New(params Params) (Engine, error) {
 		drift:                params.Drift,
 		vfioMgr:              devicemanager.NewVFIOManager(params.Logger),
 		instances:            make(map[string]processHandle),
+		deployParallelism:    deployParallelism,
+		warmPoolSize:         params.WarmPoolSize,
+		vmSnapshots:          params.VMSnapshots,
+		warmPool:             make(map[string][]string),
+		warmFilling:          make(map[string]bool),
+		driftKnown:           make(map[string]routes.Route),
+		deployCache:          make(map[int64]*deploymentCacheEntry),
 	}, nil
 }
 
@@ -208,18 +229,62 @@ type engine struct {
 	controlListenAddr    string
 	controlAdvertiseAddr string
 	controlPort          string
-	ipPool               []string
+	ipam                 *ipAllocator
+	cids                 cidAllocator
 	runtimeDir           string
 	launcher             runtime.Launcher
 	network              network.Manager
 	bus                  eventbus.Bus
 	drift                *driftclient.Client
 	vfioMgr              devicemanager.VFIOManager
+	deployParallelism    int
+	warmPoolSize         int
+	vmSnapshots          bool
+
+	// allocMu serializes IP and CID allocation so concurrent replica
+	// creation cannot race on the next free address.
+	allocMu     sync.Mutex
+	allocSeeded bool
 
 	mu         sync.Mutex
 	instances  map[string]processHandle
 	procCtx    context.Context
 	procCancel context.CancelFunc
+
+	// Warm pool bookkeeping: pre-booted instance names bucketed by
+	// configuration key, plus an in-flight marker per bucket so only
+	// one refill runs at a time.
+	warmMu      sync.Mutex
+	warmPool    map[string][]string
+	warmFilling map[string]bool
+
+	// Delta sync state for drift routes: the last route table acked by
+	// driftd, keyed protocol/host_port, and the generation counter.
+	driftMu         sync.Mutex
+	driftKnown      map[string]routes.Route
+	driftGeneration uint64
+	driftNoSync     bool
+
+	// Reconcile fingerprint cache: the last converged state per group,
+	// invalidated whenever a VM event touches the group. A reconcile
+	// whose group row still matches the cached fingerprint returns the
+	// cached deployment without walking the VM table.
+	deployCacheMu sync.Mutex
+	deployCache   map[int64]*deploymentCacheEntry
+}
+
+// deploymentFingerprint captures the desired-state inputs a reconcile
+// depends on; the group row's UpdatedAt moves on every config change.
+type deploymentFingerprint struct {
+	replicas  int
+	updatedAt time.Time
+}
+
+type deploymentCacheEntry struct {
+	gen         uint64
+	valid       bool
+	fingerprint deploymentFingerprint
+	deployment  Deployment
 }
 
 type processHandle struct {
@@ -241,9 +306,12 @@ var (
 )
 
 func (e *engine) Start(ctx context.Context) error {
-	if err := e.store.WithTx(ctx, func(q db.Queries) error {
-		return q.IPAllocations().EnsurePool(ctx, e.ipPool)
-	}); err != nil {
+	e.allocMu.Lock()
+	err := e.store.WithTx(ctx, func(q db.Queries) error {
+		return e.seedAllocators(ctx, q)
+	})
+	e.allocMu.Unlock()
+	if err != nil {
 		return err
 	}
 
@@ -261,6 +329,46 @@ func (e *engine) Start(ctx context.Context) error {
 	e.procCancel = cancel
 	e.mu.Unlock()
 
+	if e.warmPoolSize > 0 {
+		e.reapWarmLeftovers(ctx)
+	}
+
+	e.startReadinessListener(procCtx)
+
+	return nil
+}
+
+// seedAllocators loads the used IP and CID sets once — from the VM
+// table plus any leases that survived a restart — so every later
+// allocation is a pure in-memory bitmap/counter operation. Callers must
+// hold allocMu.
+func (e *engine) seedAllocators(ctx context.Context, q db.Queries) error {
+	if e.allocSeeded {
+		return nil
+	}
+	vms, err := q.VirtualMachines().List(ctx)
+	if err != nil {
+		return err
+	}
+	usedCIDs := make([]uint32, 0, len(vms))
+	for _, vm := range vms {
+		if vm.IPAddress != "" {
+			e.ipam.markUsed(vm.IPAddress)
+		}
+		if vm.VsockCID > 0 {
+			usedCIDs = append(usedCIDs, vm.VsockCID)
+		}
+	}
+	e.cids.seed(usedCIDs)
+
+	leased, err := q.IPAllocations().ListLeased(ctx)
+	if err != nil {
+		return err
+	}
+	for _, ip := range leased {
+		e.ipam.markUsed(ip)
+	}
+	e.allocSeeded = true
 	return nil
 }
 
@@ -291,7 +399,16 @@ func (e *engine) Stop(ctx context.Context) error {
 	return nil
 }
 
+// Latency histograms for the engine's hot operations, exported through
+// the API server's /metrics endpoint.
+var (
+	createVMDuration         = telemetry.NewHistogram("volantd_create_vm_duration_seconds", "Time from CreateVM request to VM ready.")
+	startVMDuration          = telemetry.NewHistogram("volantd_start_vm_duration_seconds", "Time from StartVM request to VM running.")
+	applyDriftRoutesDuration = telemetry.NewHistogram("volantd_apply_drift_routes_duration_seconds", "Time spent programming drift routes for a VM.")
+)
+
 func (e *engine) CreateVM(ctx context.Context, req CreateVMRequest) (*db.VM, error) {
+	defer createVMDuration.ObserveSince(time.Now())
 	if err := validateCreateRequest(req); err != nil {
 		return nil, err
 	}
@@ -329,6 +446,12 @@ func (e *engine) CreateVM(ctx context.Context, req CreateVMRequest) (*db.VM, err
 	// Resolve effective network configuration
 	networkCfg := resolveNetworkConfig(req.Manifest, req.Config)
 
+	var (
+		leasedIP    string
+		leasedCID   uint32
+		commitAlloc bool
+	)
+	e.allocMu.Lock()
 	err := e.store.WithTx(ctx, func(q db.Queries) error {
 		vmRepo := q.VirtualMachines()
 		existing, err := vmRepo.GetByName(ctx, req.Name)
@@ -339,14 +462,22 @@ func (e *engine) CreateVM(ctx context.Context, req CreateVMRequest) (*db.VM, err
 			return fmt.Errorf("%w: %s", ErrVMExists, req.Name)
 		}
 
+		if err := e.seedAllocators(ctx, q); err != nil {
+			return err
+		}
+
 		// Conditionally allocate IP based on network mode
 		var ipAddress string
 		if needsIPAllocation(networkCfg) {
-			allocation, err := q.IPAllocations().LeaseNextAvailable(ctx)
+			ip, err := e.ipam.allocate()
 			if err != nil {
 				return err
 			}
-			ipAddress = allocation.IPAddress
+			leasedIP = ip
+			if _, err := q.IPAllocations().LeaseSpecific(ctx, ip); err != nil {
+				return err
+			}
+			ipAddress = ip
 		} else {
 			// vsock or dhcp mode: no host-managed IP
 			ipAddress = ""
@@ -354,11 +485,11 @@ func (e *engine) CreateVM(ctx context.Context, req CreateVMRequest) (*db.VM, err
 
 		// Allocate unique vsock CID for this VM
 		// CIDs 0-2 are reserved (0=hypervisor, 1=local, 2=host)
-		// Start from 3 and find next available
-		vsockCID, err := e.allocateNextCID(ctx, vmRepo)
+		vsockCID, err := e.cids.allocate()
 		if err != nil {
 			return fmt.Errorf("allocate vsock cid: %w", err)
 		}
+		leasedCID = vsockCID
 
 		mac := deriveMAC(req.Name, ipAddress)
 		baseCmdline := buildKernelCmdline(ipAddress, e.hostIP.String(), netmask, hostname, req.KernelCmdlineHint)
@@ -389,8 +520,19 @@ func (e *engine) CreateVM(ctx context.Context, req CreateVMRequest) (*db.VM, err
 		insertedID = id
 		vm.ID = id
 		vmRecord = vm
+		commitAlloc = true
 		return nil
 	})
+	if !commitAlloc {
+		// The transaction rolled back; return the in-memory leases too.
+		if leasedIP != "" {
+			e.ipam.release(leasedIP)
+		}
+		if leasedCID != 0 {
+			e.cids.release(leasedCID)
+		}
+	}
+	e.allocMu.Unlock()
 	if err != nil {
 		return nil, err
 	}
@@ -568,6 +710,7 @@ func (e *engine) CreateVM(ctx context.Context, req CreateVMRequest) (*db.VM, err
 		if url := strings.TrimSpace(req.Manifest.RootFS.URL); url != "" {
 			spec.RootFS = url
 			spec.RootFSChecksum = strings.TrimSpace(req.Manifest.RootFS.Checksum)
+			spec.RootFSShared = req.Manifest.RootFS.Shared
 		}
 	}
 	// Apply per-VM overrides from config when provided
@@ -581,18 +724,14 @@ func (e *engine) CreateVM(ctx context.Context, req CreateVMRequest) (*db.VM, err
 		if url := strings.TrimSpace(configToStore.RootFS.URL); url != "" {
 			spec.RootFS = url
 			spec.RootFSChecksum = strings.TrimSpace(configToStore.RootFS.Checksum)
+			spec.RootFSShared = configToStore.RootFS.Shared
 		}
 	}
 	// Kernel override per-VM
 	spec.KernelOverride = strings.TrimSpace(configToStore.KernelOverride)
 	// If RootFS is set, ensure default device/fstype args unless already supplied by the runtime
 	if spec.RootFS != "" {
-		if _, ok := cmdArgs[pluginspec.RootFSDeviceKey]; !ok {
-			cmdArgs[pluginspec.RootFSDeviceKey] = "vda"
-		}
-		if _, ok := cmdArgs[pluginspec.RootFSFSTypeKey]; !ok {
-			cmdArgs[pluginspec.RootFSFSTypeKey] = "ext4"
-		}
+		applyRootFSArgs(cmdArgs, spec.RootFSShared)
 	}
 
 	// Handle VFIO GPU/device passthrough if configured (prefer VM-level overrides)
@@ -741,6 +880,11 @@ func (e *engine) destroyVM(ctx context.Context, name string, reconcile bool) (*d
 		return nil, err
 	}
 
+	if vmRecord.IPAddress != "" {
+		e.ipam.release(vmRecord.IPAddress)
+	}
+	e.cids.release(vmRecord.VsockCID)
+
 	e.mu.Lock()
 	handle, exists := e.instances[name]
 	if exists {
@@ -802,6 +946,8 @@ func (e *engine) destroyVM(ctx context.Context, name string, reconcile bool) (*d
 		}
 	}
 
+	e.discardSnapshot(name)
+
 	if vmRecord != nil {
 		vmRecord.Status = db.VMStatusStopped
 		vmRecord.PID = nil
@@ -933,10 +1079,13 @@ func (e *engine) UpdateVMConfig(ctx context.Context, name string, patch vmconfig
 	if err != nil {
 		return nil, err
 	}
+	// A new configuration invalidates any snapshot taken under the old one.
+	e.discardSnapshot(name)
 	return &updated, nil
 }
 
 func (e *engine) StartVM(ctx context.Context, name string) (*db.VM, error) {
+	defer startVMDuration.ObserveSince(time.Now())
 	e.mu.Lock()
 	if _, exists := e.instances[name]; exists {
 		e.mu.Unlock()
@@ -987,6 +1136,14 @@ func (e *engine) StartVM(ctx context.Context, name string) (*db.VM, error) {
 		return nil, err
 	}
 
+	// Prefer a pre-booted instance over a cold boot when one matches
+	// this configuration.
+	if cloudRecord == nil && !strings.HasPrefix(name, warmNamePrefix) {
+		if claimed, ok := e.claimWarmVM(ctx, vmRecord, cfg); ok {
+			return claimed, nil
+		}
+	}
+
 	apiHost := strings.TrimSpace(cfg.API.Host)
 	apiPort := strings.TrimSpace(cfg.API.Port)
 	if apiPort == "0" {
@@ -1034,6 +1191,14 @@ func (e *engine) StartVM(ctx context.Context, name string) (*db.VM, error) {
 		serialPath = absSerial
 	}
 
+	// Resume from a snapshot taken at the last clean stop when one
+	// exists; this skips the kernel boot entirely.
+	if e.vmSnapshots {
+		if restored, ok := e.restoreFromSnapshot(ctx, vmRecord, cfg, networkCfg, tapName, serialPath); ok {
+			return restored, nil
+		}
+	}
+
 	manifest := cfg.Manifest
 	if manifest == nil {
 		_ = e.network.CleanupTap(ctx, tapName)
@@ -1096,6 +1261,7 @@ func (e *engine) StartVM(ctx context.Context, name string) (*db.VM, error) {
 	if url := strings.TrimSpace(manifest.RootFS.URL); url != "" {
 		spec.RootFS = url
 		spec.RootFSChecksum = strings.TrimSpace(manifest.RootFS.Checksum)
+		spec.RootFSShared = manifest.RootFS.Shared
 	}
 	// Apply overrides without clearing the other medium
 	if cfg.Initramfs != nil {
@@ -1108,16 +1274,12 @@ func (e *engine) StartVM(ctx context.Context, name string) (*db.VM, error) {
 		if url := strings.TrimSpace(cfg.RootFS.URL); url != "" {
 			spec.RootFS = url
 			spec.RootFSChecksum = strings.TrimSpace(cfg.RootFS.Checksum)
+			spec.RootFSShared = cfg.RootFS.Shared
 		}
 	}
 	spec.KernelOverride = strings.TrimSpace(cfg.KernelOverride)
 	if spec.RootFS != "" {
-		if _, ok := cmdArgs[pluginspec.RootFSDeviceKey]; !ok {
-			cmdArgs[pluginspec.RootFSDeviceKey] = "vda"
-		}
-		if _, ok := cmdArgs[pluginspec.RootFSFSTypeKey]; !ok {
-			cmdArgs[pluginspec.RootFSFSTypeKey] = "ext4"
-		}
+		applyRootFSArgs(cmdArgs, spec.RootFSShared)
 	}
 
 	// Handle VFIO device passthrough if configured (prefer VM-level overrides)
@@ -1292,6 +1454,7 @@ func (e *engine) StopVM(ctx context.Context, name string) (*db.VM, error) {
 	}
 
 	if exists {
+		e.snapshotOnStop(ctx, name, handle)
 		if stopErr := handle.instance.Stop(ctx); stopErr != nil {
 			e.logger.Error("stop instance", "vm", "name", "error", stopErr)
 		}
@@ -1466,9 +1629,13 @@ func (e *engine) DeleteDeployment(ctx context.Context, name string) error {
 		}
 	}
 
-	return e.store.WithTx(ctx, func(q db.Queries) error {
+	if err := e.store.WithTx(ctx, func(q db.Queries) error {
 		return q.VMGroups().Delete(ctx, group.ID)
-	})
+	}); err != nil {
+		return err
+	}
+	e.dropDeploymentCache(group.ID)
+	return nil
 }
 
 func (e *engine) Store() db.Store {
@@ -1498,99 +1665,141 @@ func (e *engine) rollbackCreate(ctx context.Context, vm *db.VM) {
 		return q.IPAllocations().Release(ctx, vm.IPAddress)
 	}); err != nil {
 		e.logger.Error("rollback create", "vm", vm.Name, "error", err)
+		return
 	}
+	if vm.IPAddress != "" {
+		e.ipam.release(vm.IPAddress)
+	}
+	e.cids.release(vm.VsockCID)
 }
 
+// monitorInstance arranges for handleInstanceExit to run when the
+// instance's hypervisor process ends. Instances that support exit
+// callbacks (pidfd-backed on Linux) cost nothing while the VM runs; the
+// fallback parks a goroutine on the Wait channel as before.
 func (e *engine) monitorInstance(name string, handle processHandle) {
+	if watcher, ok := handle.instance.(runtime.ExitWatcher); ok {
+		watcher.OnExit(func(exitErr error) {
+			e.handleInstanceExit(name, handle, exitErr)
+		})
+		return
+	}
 	go func() {
-		var expose []vmconfig.Expose
-		waitCh := handle.instance.Wait()
 		var exitErr error
-		if waitCh != nil {
+		if waitCh := handle.instance.Wait(); waitCh != nil {
 			if result, ok := <-waitCh; ok {
 				exitErr = result
 			}
 		}
+		e.handleInstanceExit(name, handle, exitErr)
+	}()
+}
 
-		e.mu.Lock()
-		stored, exists := e.instances[name]
-		if !exists || stored.instance != handle.instance {
-			e.mu.Unlock()
-			return
-		}
-		delete(e.instances, name)
+// handleInstanceExit performs the state transition for a VM whose
+// hypervisor process has exited: it retires warm pool members, records
+// stopped/crashed state, tears down host-side resources, and kicks the
+// owning deployment's reconcile.
+func (e *engine) handleInstanceExit(name string, handle processHandle, exitErr error) {
+	var expose []vmconfig.Expose
+
+	e.mu.Lock()
+	stored, exists := e.instances[name]
+	if !exists || stored.instance != handle.instance {
 		e.mu.Unlock()
+		return
+	}
+	delete(e.instances, name)
+	e.mu.Unlock()
 
-		ctx := context.Background()
-		status := db.VMStatusStopped
-		if exitErr != nil {
-			status = db.VMStatusCrashed
-		}
-
-		var vmRecord *db.VM
-		if err := e.store.WithTx(ctx, func(q db.Queries) error {
-			vm, err := q.VirtualMachines().GetByName(ctx, name)
-			if err != nil {
-				return err
-			}
-			if vm == nil {
-				return nil
-			}
-			vmRecord = vm
-			if cfgRecord, cfgErr := q.VMConfigs().GetCurrent(ctx, vm.ID); cfgErr == nil && cfgRecord != nil {
-				if versioned, convErr := vmconfig.FromDB(*cfgRecord); convErr == nil {
-					expose = append([]vmconfig.Expose(nil), versioned.Config.Expose...)
-				}
-			}
-			return q.VirtualMachines().UpdateRuntimeState(ctx, vm.ID, status, nil)
-		}); err != nil {
-			e.logger.Error("update vm state", "vm", name, "error", err)
-		}
+	ctx := context.Background()
 
+	// A warm pool member that dies while pooled is simply retired;
+	// it never belonged to a user.
+	if strings.HasPrefix(name, warmNamePrefix) {
+		e.forgetWarmVM(name)
 		if err := e.network.CleanupTap(ctx, stored.tapName); err != nil {
 			e.logger.Error("cleanup tap", "tap", stored.tapName, "error", err)
 		}
-		if socket := stored.instance.APISocketPath(); socket != "" {
-			if removeErr := os.Remove(socket); removeErr != nil && !errors.Is(removeErr, os.ErrNotExist) {
-				e.logger.Debug("remove api socket", "path", socket, "error", removeErr)
-			}
+		if _, err := e.destroyVM(ctx, name, false); err != nil {
+			e.logger.Warn("retire warm vm", "vm", name, "error", err)
+		}
+		return
+	}
+
+	status := db.VMStatusStopped
+	if exitErr != nil {
+		status = db.VMStatusCrashed
+	}
+
+	var vmRecord *db.VM
+	if err := e.store.WithTx(ctx, func(q db.Queries) error {
+		vm, err := q.VirtualMachines().GetByName(ctx, name)
+		if err != nil {
+			return err
+		}
+		if vm == nil {
+			return nil
 		}
-		if stored.seedPath != "" {
-			if err := os.Remove(stored.seedPath); err != nil && !errors.Is(err, os.ErrNotExist) {
-				e.logger.Debug("remove seed image", "path", stored.seedPath, "error", err)
+		vmRecord = vm
+		if cfgRecord, cfgErr := q.VMConfigs().GetCurrent(ctx, vm.ID); cfgErr == nil && cfgRecord != nil {
+			if versioned, convErr := vmconfig.FromDB(*cfgRecord); convErr == nil {
+				expose = append([]vmconfig.Expose(nil), versioned.Config.Expose...)
 			}
 		}
+		return q.VirtualMachines().UpdateRuntimeState(ctx, vm.ID, status, nil)
+	}); err != nil {
+		e.logger.Error("update vm state", "vm", name, "error", err)
+	}
 
-		if len(expose) > 0 {
-			e.removeDriftRoutes(ctx, name, expose)
+	if err := e.network.CleanupTap(ctx, stored.tapName); err != nil {
+		e.logger.Error("cleanup tap", "tap", stored.tapName, "error", err)
+	}
+	if socket := stored.instance.APISocketPath(); socket != "" {
+		if removeErr := os.Remove(socket); removeErr != nil && !errors.Is(removeErr, os.ErrNotExist) {
+			e.logger.Debug("remove api socket", "path", socket, "error", removeErr)
+		}
+	}
+	if stored.seedPath != "" {
+		if err := os.Remove(stored.seedPath); err != nil && !errors.Is(err, os.ErrNotExist) {
+			e.logger.Debug("remove seed image", "path", stored.seedPath, "error", err)
 		}
+	}
 
-		if exitErr != nil {
-			e.logger.Warn("vm exited unexpectedly", "vm", name, "error", exitErr)
-			if vmRecord != nil {
-				vmRecord.Status = db.VMStatusCrashed
-				vmRecord.PID = nil
-			}
-			e.publishEvent(ctx, orchestratorevents.TypeVMCrashed, orchestratorevents.VMStatusCrashed, vmRecord, exitErr.Error())
-		} else {
+	if len(expose) > 0 {
+		e.removeDriftRoutes(ctx, name, expose)
+	}
 
-			if vmRecord != nil && vmRecord.GroupID != nil {
-				if _, err := e.reconcileDeploymentByID(ctx, *vmRecord.GroupID); err != nil {
-					e.logger.Error("reconcile deployment after vm exit", "vm", name, "error", err)
-				}
-			}
-			e.logger.Info("vm exited", "vm", name)
-			if vmRecord != nil {
-				vmRecord.Status = db.VMStatusStopped
-				vmRecord.PID = nil
+	if exitErr != nil {
+		e.logger.Warn("vm exited unexpectedly", "vm", name, "error", exitErr)
+		if vmRecord != nil {
+			vmRecord.Status = db.VMStatusCrashed
+			vmRecord.PID = nil
+		}
+		e.publishEvent(ctx, orchestratorevents.TypeVMCrashed, orchestratorevents.VMStatusCrashed, vmRecord, exitErr.Error())
+	} else {
+
+		if vmRecord != nil && vmRecord.GroupID != nil {
+			if _, err := e.reconcileDeploymentByID(ctx, *vmRecord.GroupID); err != nil {
+				e.logger.Error("reconcile deployment after vm exit", "vm", name, "error", err)
 			}
-			e.publishEvent(ctx, orchestratorevents.TypeVMStopped, orchestratorevents.VMStatusStopped, vmRecord, "vm exited cleanly")
 		}
-	}()
+		e.logger.Info("vm exited", "vm", name)
+		if vmRecord != nil {
+			vmRecord.Status = db.VMStatusStopped
+			vmRecord.PID = nil
+		}
+		e.publishEvent(ctx, orchestratorevents.TypeVMStopped, orchestratorevents.VMStatusStopped, vmRecord, "vm exited cleanly")
+	}
 }
 
 func (e *engine) publishEvent(ctx context.Context, typ string, status orchestratorevents.VMStatus, vm *db.VM, message string) {
-	if e.bus == nil || vm == nil {
+	if vm == nil {
+		return
+	}
+	if vm.GroupID != nil {
+		e.invalidateDeploymentCache(*vm.GroupID)
+	}
+	if e.bus == nil {
 		return
 	}
 
@@ -1627,7 +1836,62 @@ func (e *engine) reconcileDeploymentByID(ctx context.Context, groupID int64) (*D
 	return &deployment, nil
 }
 
+// deployCacheLookup returns the cached deployment when the group row
+// still matches the fingerprint recorded by the last converged
+// reconcile, along with the generation to hand back to deployCacheStore.
+func (e *engine) deployCacheLookup(groupID int64, fp deploymentFingerprint) (Deployment, uint64, bool) {
+	e.deployCacheMu.Lock()
+	defer e.deployCacheMu.Unlock()
+	entry, ok := e.deployCache[groupID]
+	if !ok {
+		entry = &deploymentCacheEntry{}
+		e.deployCache[groupID] = entry
+	}
+	if entry.valid && entry.fingerprint == fp {
+		return entry.deployment, entry.gen, true
+	}
+	return Deployment{}, entry.gen, false
+}
+
+// deployCacheStore records a reconcile result unless the group was
+// invalidated while the reconcile ran.
+func (e *engine) deployCacheStore(groupID int64, gen uint64, fp deploymentFingerprint, deployment Deployment) {
+	e.deployCacheMu.Lock()
+	defer e.deployCacheMu.Unlock()
+	entry, ok := e.deployCache[groupID]
+	if !ok || entry.gen != gen {
+		return
+	}
+	entry.valid = true
+	entry.fingerprint = fp
+	entry.deployment = deployment
+}
+
+// invalidateDeploymentCache marks a group dirty so the next reconcile
+// runs in full. Driven from publishEvent, so any VM lifecycle event
+// touching the group forces a real pass.
+func (e *engine) invalidateDeploymentCache(groupID int64) {
+	e.deployCacheMu.Lock()
+	defer e.deployCacheMu.Unlock()
+	if entry, ok := e.deployCache[groupID]; ok {
+		entry.gen++
+		entry.valid = false
+	}
+}
+
+func (e *engine) dropDeploymentCache(groupID int64) {
+	e.deployCacheMu.Lock()
+	defer e.deployCacheMu.Unlock()
+	delete(e.deployCache, groupID)
+}
+
 func (e *engine) reconcileDeployment(ctx context.Context, group db.VMGroup) (Deployment, error) {
+	fp := deploymentFingerprint{replicas: group.Replicas, updatedAt: group.UpdatedAt}
+	cached, gen, ok := e.deployCacheLookup(group.ID, fp)
+	if ok {
+		return cached, nil
+	}
+
 	config, err := vmconfig.Unmarshal(group.ConfigJSON)
 	if err != nil {
 		return Deployment{}, err
@@ -1669,36 +1933,52 @@ func (e *engine) reconcileDeployment(ctx context.Context, group db.VMGroup) (Dep
 				existing[idx] = true
 			}
 		}
-		groupID := group.ID
-		for i := 1; len(existing) < desired; i++ {
+		missing := make([]int, 0, desired-len(existing))
+		for i := 1; len(existing)+len(missing) < desired; i++ {
 			if existing[i] {
 				continue
 			}
-			vmName := replicaName(group.Name, i)
-			manifestCopy := *config.Manifest
-			manifestCopy.Normalize()
-			cfgClone := config.Clone()
-			cfgClone.Normalize()
-			request := CreateVMRequest{
-				Name:              vmName,
-				Plugin:            cfgClone.Plugin,
-				Runtime:           cfgClone.Runtime,
-				CPUCores:          cfgClone.Resources.CPUCores,
-				MemoryMB:          cfgClone.Resources.MemoryMB,
-				KernelCmdlineHint: cfgClone.KernelCmdline,
-				Manifest:          &manifestCopy,
-				APIHost:           cfgClone.API.Host,
-				APIPort:           cfgClone.API.Port,
-				Config:            &cfgClone,
-			}
-			request.GroupID = &groupID
-			if _, err := e.CreateVM(ctx, request); err != nil {
-				e.logger.Error("scale up deployment", "deployment", group.Name, "vm", vmName, "error", err)
-				break
-			} else {
-				existing[i] = true
-			}
+			missing = append(missing, i)
 		}
+
+		// Provision replicas through a bounded worker pool so scaling
+		// out by N does not cost N sequential create+boot cycles. A
+		// failed replica is logged and skipped; the rest of the batch
+		// proceeds and the next reconcile retries the gap.
+		groupID := group.ID
+		sem := make(chan struct{}, e.deployParallelism)
+		var wg sync.WaitGroup
+		for _, idx := range missing {
+			wg.Add(1)
+			sem <- struct{}{}
+			go func(idx int) {
+				defer wg.Done()
+				defer func() { <-sem }()
+				vmName := replicaName(group.Name, idx)
+				manifestCopy := *config.Manifest
+				manifestCopy.Normalize()
+				cfgClone := config.Clone()
+				cfgClone.Normalize()
+				request := CreateVMRequest{
+					Name:              vmName,
+					Plugin:            cfgClone.Plugin,
+					Runtime:           cfgClone.Runtime,
+					CPUCores:          cfgClone.Resources.CPUCores,
+					MemoryMB:          cfgClone.Resources.MemoryMB,
+					KernelCmdlineHint: cfgClone.KernelCmdline,
+					Manifest:          &manifestCopy,
+					APIHost:           cfgClone.API.Host,
+					APIPort:           cfgClone.API.Port,
+					Config:            &cfgClone,
+				}
+				request.GroupID = &groupID
+				if _, err := e.CreateVM(ctx, request); err != nil {
+					e.logger.Error("scale up deployment", "deployment", group.Name, "vm", vmName, "error", err)
+				}
+			}(idx)
+		}
+		wg.Wait()
+
 		vms, err = vmRepo.ListByGroupID(ctx, group.ID)
 		if err != nil {
 			return Deployment{}, err
@@ -1709,6 +1989,16 @@ func (e *engine) reconcileDeployment(ctx context.Context, group db.VMGroup) (Dep
 	if err != nil {
 		return Deployment{}, err
 	}
+
+	e.syncDeploymentRoutes(ctx, group, config)
+
+	// Cache only a converged pass; events fired by the scaling work
+	// above bump the generation, in which case the next reconcile takes
+	// one more full walk before settling.
+	if len(vms) == desired {
+		e.deployCacheStore(group.ID, gen, fp, deployment)
+	}
+
 	return deployment, nil
 }
 
@@ -1832,7 +2122,7 @@ func (e *engine) prepareCloudInitSeed(ctx context.Context, vm *db.VM, manifest *
 		MetaData:      strings.TrimSpace(merged.MetaData.Content),
 		NetworkConfig: strings.TrimSpace(merged.NetworkCfg.Content),
 	}
-	if err := cloudinit.Build(ctx, input, seedPath); err != nil {
+	if err := cloudinit.BuildCached(ctx, input, filepath.Join(seedsDir, "cache"), seedPath); err != nil {
 		return nil, nil, nil, fmt.Errorf("cloud-init build: %w", err)
 	}
 
@@ -1969,6 +2259,25 @@ func sanitizeHostname(name string) string {
 	return string(cleaned)
 }
 
+// applyRootFSArgs fills in the guest-side rootfs parameters unless the
+// runtime already supplied them. Shared images attach as a pmem device
+// and the agent mounts them read-only under a tmpfs overlay.
+func applyRootFSArgs(cmdArgs map[string]string, shared bool) {
+	defaultDevice := "vda"
+	if shared {
+		defaultDevice = "pmem0"
+		if _, ok := cmdArgs[pluginspec.RootFSModeKey]; !ok {
+			cmdArgs[pluginspec.RootFSModeKey] = "overlay"
+		}
+	}
+	if _, ok := cmdArgs[pluginspec.RootFSDeviceKey]; !ok {
+		cmdArgs[pluginspec.RootFSDeviceKey] = defaultDevice
+	}
+	if _, ok := cmdArgs[pluginspec.RootFSFSTypeKey]; !ok {
+		cmdArgs[pluginspec.RootFSFSTypeKey] = "ext4"
+	}
+}
+
 func buildKernelCmdline(ip, gateway, netmask, hostname, extra string) string {
 	base := fmt.Sprintf("console=ttyS0 reboot=k panic=1 quiet loglevel=1 i8042.noaux i8042.nokbd pci=lastbus=0 ip=%s::%s:%s:%s:eth0:off", ip, gateway, netmask, hostname)
 	extra = strings.TrimSpace(extra)
@@ -2015,49 +2324,6 @@ func cloneArgs(args map[string]string) map[string]string {
 	return dup
 }
 
-func deriveIPPool(subnet *net.IPNet, hostIP net.IP) ([]string, error) {
-	ipv4 := subnet.IP.To4()
-	if ipv4 == nil {
-		return nil, fmt.Errorf("ipv6 subnets are not supported: %s", subnet)
-	}
-
-	ones, bits := subnet.Mask.Size()
-	hostBits := bits - ones
-	if hostBits <= 0 {
-		return nil, fmt.Errorf("invalid subnet mask: %s", subnet.Mask)
-	}
-
-	total := 1 << hostBits
-	base := binary.BigEndian.Uint32(ipv4.Mask(subnet.Mask))
-	host := binary.BigEndian.Uint32(hostIP.To4())
-
-	pool := make([]string, 0, total-2)
-	for i := 0; i < total; i++ {
-		addr := base + uint32(i)
-		ip := make(net.IP, net.IPv4len)
-		binary.BigEndian.PutUint32(ip, addr)
-
-		if !subnet.Contains(ip) {
-			continue
-		}
-		if addr == base { // network address
-			continue
-		}
-		if addr == base+uint32(total-1) { // broadcast
-			continue
-		}
-		if addr == host {
-			continue
-		}
-		pool = append(pool, ip.String())
-	}
-
-	if len(pool) == 0 {
-		return nil, fmt.Errorf("no assignable IPs in subnet %s", subnet)
-	}
-	return pool, nil
-}
-
 func formatNetmask(mask net.IPMask) string {
 	if len(mask) != 4 {
 		return "255.255.255.0"
@@ -2263,83 +2529,211 @@ func (e *engine) applyDriftRoutes(ctx context.Context, vm db.VM, netCfg *plugins
 	if e.drift == nil || len(exposes) == 0 {
 		return nil
 	}
+	defer applyDriftRoutesDuration.ObserveSince(time.Now())
 
 	routesToApply, err := e.computeDriftRoutes(vm, netCfg, exposes)
 	if err != nil {
 		return err
 	}
 
-	applied := make([]routes.Route, 0, len(routesToApply))
-	for _, route := range routesToApply {
-		if _, err := e.drift.UpsertRoute(ctx, route); err != nil {
-			for i := len(applied) - 1; i >= 0; i-- {
-				prev := applied[i]
-				if delErr := e.drift.DeleteRoute(ctx, prev.Protocol, prev.HostPort); delErr != nil {
-					var apiErr *driftclient.APIError
-					if !(errors.As(delErr, &apiErr) && apiErr.Status == http.StatusNotFound) {
-						e.logger.Warn("rollback drift route", "vm", vm.Name, "protocol", prev.Protocol, "host_port", prev.HostPort, "error", delErr)
-					}
-				}
+	return e.pushDriftDelta(ctx, routesToApply, nil)
+}
+
+// pushDriftDelta sends only the routes that differ from what driftd
+// last acked, stamped with the next generation, so reconciles that
+// touch 50 replicas program 50 entries instead of re-posting the whole
+// table. Daemons that predate the sync endpoint fall back to per-route
+// calls permanently for the life of the process.
+func (e *engine) pushDriftDelta(ctx context.Context, adds []routes.Route, removes []routes.RouteKey) error {
+	if e.drift == nil {
+		return nil
+	}
+
+	e.driftMu.Lock()
+	defer e.driftMu.Unlock()
+
+	changed := make([]routes.Route, 0, len(adds))
+	for _, route := range adds {
+		key := fmt.Sprintf("%s/%d", route.Protocol, route.HostPort)
+		if known, ok := e.driftKnown[key]; ok && known.Equal(route) {
+			continue
+		}
+		changed = append(changed, route)
+	}
+	if len(changed) == 0 && len(removes) == 0 {
+		return nil
+	}
+
+	if !e.driftNoSync {
+		req := routes.SyncRequest{
+			Generation: e.driftGeneration + 1,
+			Adds:       changed,
+			Removes:    removes,
+		}
+		resp, err := e.drift.SyncRoutes(ctx, req)
+		if err == nil && resp.Generation != req.Generation {
+			// driftd acks an applied delta by echoing its generation; a
+			// higher one means driftd outlived a volantd restart and
+			// discarded our delta as a replay. Adopt its generation and
+			// resend so the routes are not silently lost.
+			req.Generation = resp.Generation + 1
+			resp, err = e.drift.SyncRoutes(ctx, req)
+			if err == nil && resp.Generation != req.Generation {
+				return fmt.Errorf("sync drift routes: generation conflict, driftd at %d", resp.Generation)
 			}
+		}
+		if err == nil {
+			e.driftGeneration = resp.Generation
+			e.commitDriftDelta(changed, removes)
+			return nil
+		}
+		var apiErr *driftclient.APIError
+		if errors.As(err, &apiErr) && (apiErr.Status == http.StatusNotFound || apiErr.Status == http.StatusMethodNotAllowed) {
+			e.driftNoSync = true
+			e.logger.Warn("driftd lacks route sync endpoint, using per-route calls")
+		} else {
+			return fmt.Errorf("sync drift routes: %w", err)
+		}
+	}
+
+	for _, route := range changed {
+		if _, err := e.drift.UpsertRoute(ctx, route); err != nil {
 			return fmt.Errorf("apply drift route %s/%d: %w", route.Protocol, route.HostPort, err)
 		}
-		applied = append(applied, route)
+		e.commitDriftDelta([]routes.Route{route}, nil)
+	}
+	for _, key := range removes {
+		if err := e.drift.DeleteRoute(ctx, key.Protocol, key.HostPort); err != nil {
+			var apiErr *driftclient.APIError
+			if !(errors.As(err, &apiErr) && apiErr.Status == http.StatusNotFound) {
+				return fmt.Errorf("remove drift route %s/%d: %w", key.Protocol, key.HostPort, err)
+			}
+		}
+		e.commitDriftDelta(nil, []routes.RouteKey{key})
 	}
 	return nil
 }
 
-func (e *engine) removeDriftRoutes(ctx context.Context, vmName string, exposes []vmconfig.Expose) {
-	if e.drift == nil || len(exposes) == 0 {
+// commitDriftDelta records what driftd now holds. Callers must hold
+// driftMu.
+func (e *engine) commitDriftDelta(adds []routes.Route, removes []routes.RouteKey) {
+	for _, route := range adds {
+		e.driftKnown[fmt.Sprintf("%s/%d", route.Protocol, route.HostPort)] = route
+	}
+	for _, key := range removes {
+		delete(e.driftKnown, fmt.Sprintf("%s/%d", key.Protocol, key.HostPort))
+	}
+}
+
+// syncDeploymentRoutes reprograms a deployment's bridged drift routes
+// with a weighted backend set spanning every running replica, so an
+// exposed host port load-balances across the group instead of pointing
+// at whichever replica applied its per-VM route last.
+func (e *engine) syncDeploymentRoutes(ctx context.Context, group db.VMGroup, cfg vmconfig.Config) {
+	if e.drift == nil || len(cfg.Expose) == 0 {
+		return
+	}
+
+	vms, err := e.store.Queries().VirtualMachines().ListByGroupID(ctx, group.ID)
+	if err != nil {
+		e.logger.Warn("sync deployment routes", "deployment", group.Name, "error", err)
 		return
 	}
+
+	netCfg := resolveNetworkConfig(cfg.Manifest, &cfg)
+	defaultMode := ""
+	if netCfg != nil {
+		defaultMode = strings.TrimSpace(strings.ToLower(string(netCfg.Mode)))
+	}
+	if defaultMode == "" {
+		defaultMode = string(pluginspec.NetworkModeBridged)
+	}
+
 	seen := make(map[string]struct{})
-	for _, rule := range exposes {
-		hostPort := rule.HostPort
-		if hostPort <= 0 {
+	desired := make([]routes.Route, 0, len(cfg.Expose))
+	for _, rule := range cfg.Expose {
+		if rule.HostPort <= 0 {
 			continue
 		}
 		protocol := strings.TrimSpace(strings.ToLower(rule.Protocol))
 		if protocol == "" {
 			protocol = "tcp"
 		}
-		key := fmt.Sprintf("%s/%d", protocol, hostPort)
+		mode := strings.TrimSpace(strings.ToLower(rule.Mode))
+		if mode == "" {
+			mode = defaultMode
+		}
+		switch mode {
+		case "", "bridged", "bridge", "dhcp":
+		default:
+			// vsock exposures terminate in a per-VM proxy and stay per-VM.
+			continue
+		}
+		key := fmt.Sprintf("%s/%d", protocol, rule.HostPort)
 		if _, ok := seen[key]; ok {
 			continue
 		}
 		seen[key] = struct{}{}
-		if err := e.drift.DeleteRoute(ctx, protocol, uint16(hostPort)); err != nil {
-			var apiErr *driftclient.APIError
-			if errors.As(err, &apiErr) && apiErr.Status == http.StatusNotFound {
+
+		backends := make([]routes.Backend, 0, len(vms))
+		for _, vm := range vms {
+			if vm.Status != db.VMStatusRunning {
+				continue
+			}
+			parsed := net.ParseIP(strings.TrimSpace(vm.IPAddress))
+			if parsed == nil || parsed.To4() == nil {
 				continue
 			}
-			e.logger.Warn("remove drift route", "vm", vmName, "protocol", protocol, "host_port", hostPort, "error", err)
+			backends = append(backends, routes.Backend{
+				Type:   routes.BackendBridge,
+				IP:     parsed.To4().String(),
+				Port:   uint16(rule.Port),
+				Weight: 1,
+			})
+			if len(backends) == routes.MaxBackends {
+				break
+			}
+		}
+		if len(backends) == 0 {
+			continue
 		}
-	}
-}
 
-// allocateNextCID finds the next available vsock CID starting from 3.
-// CIDs 0-2 are reserved: 0=hypervisor, 1=local, 2=host.
-func (e *engine) allocateNextCID(ctx context.Context, vmRepo db.VMRepository) (uint32, error) {
-	vms, err := vmRepo.List(ctx)
-	if err != nil {
-		return 0, err
+		desired = append(desired, routes.Route{
+			HostPort: uint16(rule.HostPort),
+			Protocol: protocol,
+			Backend:  backends[0],
+			Backends: backends,
+		})
 	}
 
-	// Collect all used CIDs
-	used := make(map[uint32]bool)
-	for _, vm := range vms {
-		if vm.VsockCID > 0 {
-			used[vm.VsockCID] = true
-		}
+	if err := e.pushDriftDelta(ctx, desired, nil); err != nil {
+		e.logger.Warn("sync deployment routes", "deployment", group.Name, "error", err)
 	}
+}
 
-	// Find first available CID starting from 3
-	// CIDs 0-2 are reserved
-	for cid := uint32(3); cid < 1<<32-1; cid++ {
-		if !used[cid] {
-			return cid, nil
+func (e *engine) removeDriftRoutes(ctx context.Context, vmName string, exposes []vmconfig.Expose) {
+	if e.drift == nil || len(exposes) == 0 {
+		return
+	}
+	seen := make(map[string]struct{})
+	removes := make([]routes.RouteKey, 0, len(exposes))
+	for _, rule := range exposes {
+		hostPort := rule.HostPort
+		if hostPort <= 0 {
+			continue
 		}
+		protocol := strings.TrimSpace(strings.ToLower(rule.Protocol))
+		if protocol == "" {
+			protocol = "tcp"
+		}
+		key := fmt.Sprintf("%s/%d", protocol, hostPort)
+		if _, ok := seen[key]; ok {
+			continue
+		}
+		seen[key] = struct{}{}
+		removes = append(removes, routes.RouteKey{HostPort: uint16(hostPort), Protocol: protocol})
+	}
+	if err := e.pushDriftDelta(ctx, nil, removes); err != nil {
+		e.logger.Warn("remove drift routes", "vm", vmName, "error", err)
 	}
-
-	return 0, fmt.Errorf("no available vsock CIDs")
 }
@@ -184,7 +184,7 @@ func TestDeploymentScaling(t *testing.T) {
 	}
 }
 
-func openTestStore(t *testing.T) *sqlite.Store {
+func openTestStore(t testing.TB) *sqlite.Store {
 	t.Helper()
 	path := filepath.Join(t.TempDir(), "state.db")
 	store, err := sqlite.Open(context.Background(), path)
@@ -194,7 +194,7 @@ func openTestStore(t *testing.T) *sqlite.Store {
 	return store
 }
 
-func testSubnet(t *testing.T) (*net.IPNet, net.IP) {
+func testSubnet(t testing.TB) (*net.IPNet, net.IP) {
 	t.Helper()
 	_, subnet, err := net.ParseCIDR("192.168.127.0/24")
 	if err != nil {
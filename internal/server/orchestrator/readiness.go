@@ -0,0 +1,110 @@
+// Copyright (c) 2025 HYPR. PTE. LTD.
+//
+// Business Source License 1.1
+// See LICENSE file in the project root for details.
+
+package orchestrator
+
+import (
+	"context"
+	"encoding/json"
+	"net"
+	"time"
+
+	"github.com/mdlayher/vsock"
+
+	"github.com/volantvm/volant/internal/pluginspec"
+	"github.com/volantvm/volant/internal/server/db"
+	orchestratorevents "github.com/volantvm/volant/internal/server/orchestrator/events"
+)
+
+// readinessNotification mirrors the payload kestrel pushes when its
+// workload's health state changes. The VM is identified by the vsock
+// context ID on the connection, not by the payload.
+type readinessNotification struct {
+	Status    string    `json:"status"`
+	Timestamp time.Time `json:"timestamp"`
+}
+
+// startReadinessListener accepts guest-initiated readiness pushes on the
+// dedicated vsock notification port, so boot-to-ready is observed the
+// moment kestrel's health check passes instead of on the next poll tick.
+// The listener is best-effort: without vsock support (tests, non-Linux
+// hosts) it logs once and the existing polling paths carry on alone.
+func (e *engine) startReadinessListener(ctx context.Context) {
+	listener, err := vsock.Listen(pluginspec.ReadinessVsockPort, nil)
+	if err != nil {
+		e.logger.Debug("vsock readiness listener unavailable", "port", pluginspec.ReadinessVsockPort, "error", err)
+		return
+	}
+
+	go func() {
+		<-ctx.Done()
+		_ = listener.Close()
+	}()
+
+	go func() {
+		e.logger.Info("vsock readiness listener started", "port", pluginspec.ReadinessVsockPort)
+		for {
+			conn, err := listener.Accept()
+			if err != nil {
+				if ctx.Err() != nil {
+					return
+				}
+				e.logger.Debug("readiness accept", "error", err)
+				continue
+			}
+			go e.handleReadinessConn(ctx, conn)
+		}
+	}()
+}
+
+func (e *engine) handleReadinessConn(ctx context.Context, conn net.Conn) {
+	defer conn.Close()
+	_ = conn.SetReadDeadline(time.Now().Add(5 * time.Second))
+
+	addr, ok := conn.RemoteAddr().(*vsock.Addr)
+	if !ok {
+		return
+	}
+
+	var notification readinessNotification
+	if err := json.NewDecoder(conn).Decode(&notification); err != nil {
+		e.logger.Debug("readiness decode", "cid", addr.ContextID, "error", err)
+		return
+	}
+
+	vmRecord, err := e.vmByCID(ctx, addr.ContextID)
+	if err != nil {
+		e.logger.Warn("readiness lookup", "cid", addr.ContextID, "error", err)
+		return
+	}
+	if vmRecord == nil {
+		e.logger.Warn("readiness push from unknown cid", "cid", addr.ContextID)
+		return
+	}
+
+	switch notification.Status {
+	case "ready":
+		e.publishEvent(ctx, orchestratorevents.TypeVMReady, orchestratorevents.VMStatusRunning, vmRecord, "workload ready")
+	case "unhealthy":
+		e.publishEvent(ctx, orchestratorevents.TypeVMUnhealthy, orchestratorevents.VMStatus(vmRecord.Status), vmRecord, "workload unhealthy")
+	default:
+		e.logger.Debug("readiness push with unknown status", "cid", addr.ContextID, "status", notification.Status)
+	}
+}
+
+// vmByCID resolves the VM that owns a vsock context ID. Pushes are rare
+// (one per health transition), so a table scan is fine here.
+func (e *engine) vmByCID(ctx context.Context, cid uint32) (*db.VM, error) {
+	vms, err := e.store.Queries().VirtualMachines().List(ctx)
+	if err != nil {
+		return nil, err
+	}
+	for i := range vms {
+		if vms[i].VsockCID == cid {
+			return &vms[i], nil
+		}
+	}
+	return nil, nil
+}
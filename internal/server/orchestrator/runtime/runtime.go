@@ -25,6 +25,10 @@ type LaunchSpec struct {
 	Args           map[string]string
 	RootFS         string
 	RootFSChecksum string
+	// RootFSShared attaches the rootfs read-only from one shared host
+	// file instead of giving the VM a private writable copy; the guest
+	// overlays a tmpfs for writes.
+	RootFSShared bool
 	// Initramfs, when set, is fetched and used as the initramfs image for the VM.
 	// If provided, the launcher will prefer a vmlinux kernel (unless KernelOverride is set).
 	Initramfs         string
@@ -52,7 +56,23 @@ type Instance interface {
 	Wait() <-chan error
 }
 
+// ExitWatcher is implemented by instances that can invoke a callback
+// when the hypervisor process exits. It lets the orchestrator supervise
+// VMs event-driven instead of parking a goroutine on Wait per instance.
+type ExitWatcher interface {
+	OnExit(func(err error))
+}
+
 // Launcher is responsible for launching microVMs using a specific hypervisor implementation.
 type Launcher interface {
 	Launch(ctx context.Context, spec LaunchSpec) (Instance, error)
 }
+
+// Snapshotter is implemented by launchers that can capture a running
+// instance's state and later restore it instead of cold-booting.
+// Restored instances carry the identity baked in at the original boot,
+// so a snapshot is only valid for the VM it was taken from.
+type Snapshotter interface {
+	Snapshot(ctx context.Context, inst Instance, destDir string) error
+	Restore(ctx context.Context, spec LaunchSpec, snapshotDir string) (Instance, error)
+}
@@ -0,0 +1,116 @@
+// Copyright (c) 2025 HYPR. PTE. LTD.
+//
+// Business Source License 1.1
+// See LICENSE file in the project root for details.
+
+package orchestrator
+
+import (
+	"context"
+	"errors"
+	"os"
+	"path/filepath"
+
+	"github.com/volantvm/volant/internal/pluginspec"
+	"github.com/volantvm/volant/internal/server/db"
+	orchestratorevents "github.com/volantvm/volant/internal/server/orchestrator/events"
+	"github.com/volantvm/volant/internal/server/orchestrator/runtime"
+	"github.com/volantvm/volant/internal/server/orchestrator/vmconfig"
+)
+
+// snapshotDir is where a VM's hypervisor snapshot lives between a
+// clean stop and the next start.
+func (e *engine) snapshotDir(name string) string {
+	return filepath.Join(e.runtimeDir, "snapshots", name)
+}
+
+// discardSnapshot removes a VM's snapshot; it is called whenever the
+// captured state can no longer be trusted (restore consumed it, the
+// configuration changed, or the VM was destroyed).
+func (e *engine) discardSnapshot(name string) {
+	if err := os.RemoveAll(e.snapshotDir(name)); err != nil && !errors.Is(err, os.ErrNotExist) {
+		e.logger.Debug("remove snapshot", "vm", name, "error", err)
+	}
+}
+
+// snapshotOnStop captures instance state ahead of a clean stop so the
+// next start can restore in tens of milliseconds instead of booting a
+// kernel. Seed-backed VMs are skipped: their seed disk is deleted on
+// stop and the snapshot would reference it.
+func (e *engine) snapshotOnStop(ctx context.Context, name string, handle processHandle) {
+	if !e.vmSnapshots || handle.seedPath != "" {
+		return
+	}
+	snapshotter, ok := e.launcher.(runtime.Snapshotter)
+	if !ok {
+		return
+	}
+	if err := snapshotter.Snapshot(ctx, handle.instance, e.snapshotDir(name)); err != nil {
+		e.logger.Warn("snapshot vm on stop", "vm", name, "error", err)
+		e.discardSnapshot(name)
+	}
+}
+
+// restoreFromSnapshot tries to resume the VM from a snapshot taken at
+// its last clean stop. The snapshot is consumed either way: once the
+// guest runs again its disk state diverges from the capture. Returns
+// false when no usable snapshot exists; the caller cold-boots.
+func (e *engine) restoreFromSnapshot(ctx context.Context, vm *db.VM, cfg vmconfig.Config, networkCfg *pluginspec.NetworkConfig, tapName, serialPath string) (*db.VM, bool) {
+	snapshotter, ok := e.launcher.(runtime.Snapshotter)
+	if !ok {
+		return nil, false
+	}
+	dir := e.snapshotDir(vm.Name)
+	if _, err := os.Stat(filepath.Join(dir, "config.json")); err != nil {
+		return nil, false
+	}
+
+	spec := runtime.LaunchSpec{
+		Name:         vm.Name,
+		TapDevice:    tapName,
+		MACAddress:   vm.MACAddress,
+		IPAddress:    vm.IPAddress,
+		VsockCID:     vm.VsockCID,
+		SerialSocket: serialPath,
+	}
+	instance, err := snapshotter.Restore(e.launchContext(), spec, dir)
+	e.discardSnapshot(vm.Name)
+	if err != nil {
+		e.logger.Warn("restore vm snapshot", "vm", vm.Name, "error", err)
+		return nil, false
+	}
+
+	pid := int64(instance.PID())
+	if err := e.store.WithTx(ctx, func(q db.Queries) error {
+		repo := q.VirtualMachines()
+		if err := repo.UpdateRuntimeState(ctx, vm.ID, db.VMStatusRunning, &pid); err != nil {
+			return err
+		}
+		return repo.UpdateSockets(ctx, vm.ID, serialPath)
+	}); err != nil {
+		e.logger.Error("record restored vm", "vm", vm.Name, "error", err)
+		_ = instance.Stop(ctx)
+		return nil, false
+	}
+
+	e.mu.Lock()
+	handle := processHandle{instance: instance, tapName: tapName, serial: serialPath}
+	e.instances[vm.Name] = handle
+	e.mu.Unlock()
+	e.monitorInstance(vm.Name, handle)
+
+	vm.Status = db.VMStatusRunning
+	vm.PID = &pid
+	vm.SerialSocket = serialPath
+	vm.CPUCores = cfg.Resources.CPUCores
+	vm.MemoryMB = cfg.Resources.MemoryMB
+
+	if e.drift != nil && len(cfg.Expose) > 0 {
+		if err := e.applyDriftRoutes(ctx, *vm, networkCfg, cfg.Expose); err != nil {
+			e.logger.Error("apply drift routes after restore", "vm", vm.Name, "error", err)
+		}
+	}
+
+	e.publishEvent(ctx, orchestratorevents.TypeVMRunning, orchestratorevents.VMStatusRunning, vm, "vm restored from snapshot")
+	return vm, true
+}
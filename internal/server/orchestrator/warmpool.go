@@ -0,0 +1,299 @@
+// Copyright (c) 2025 HYPR. PTE. LTD.
+//
+// Business Source License 1.1
+// See LICENSE file in the project root for details.
+
+package orchestrator
+
+import (
+	"context"
+	"crypto/rand"
+	"crypto/sha256"
+	"encoding/hex"
+	"fmt"
+	"strings"
+
+	"github.com/volantvm/volant/internal/pluginspec"
+	"github.com/volantvm/volant/internal/server/db"
+	orchestratorevents "github.com/volantvm/volant/internal/server/orchestrator/events"
+	"github.com/volantvm/volant/internal/server/orchestrator/vmconfig"
+)
+
+// warmNamePrefix marks pool-owned VM records so they can be told apart
+// from user VMs across restarts.
+const warmNamePrefix = "volant-warm-"
+
+// warmPoolKey derives the pool bucket for a configuration. Everything
+// that is baked into the guest at boot (plugin, runtime, resources,
+// manifest, kernel cmdline, API endpoint) must match for a warm
+// instance to be interchangeable; expose rules are applied at claim
+// time and do not split the pool.
+func warmPoolKey(cfg vmconfig.Config) string {
+	reduced := cfg.Clone()
+	reduced.Expose = nil
+	payload, err := vmconfig.Marshal(reduced)
+	if err != nil {
+		return fmt.Sprintf("%s/%s", cfg.Plugin, cfg.Runtime)
+	}
+	sum := sha256.Sum256(payload)
+	return hex.EncodeToString(sum[:])
+}
+
+// warmPoolEligible reports whether a configuration can be served from
+// the warm pool. Cloud-init seeds and VFIO passthrough carry per-VM
+// state that cannot be transferred to a claimed instance.
+func (e *engine) warmPoolEligible(cfg vmconfig.Config) bool {
+	if e.warmPoolSize < 1 {
+		return false
+	}
+	if cfg.Manifest == nil {
+		return false
+	}
+	if cfg.CloudInit != nil || cfg.Manifest.CloudInit != nil {
+		return false
+	}
+	devCfg := cfg.Devices
+	if devCfg == nil {
+		devCfg = cfg.Manifest.Devices
+	}
+	if devCfg != nil && len(devCfg.PCIPassthrough) > 0 {
+		return false
+	}
+	return true
+}
+
+// claimWarmVM tries to hand the named VM a pre-booted instance from
+// the pool. On success the VM record adopts the warm instance's
+// identity (IP, MAC, vsock CID, kernel cmdline — the guest booted with
+// those and cannot be re-identified) and the warm record is retired.
+// Returns false when the pool has no matching member; the caller falls
+// back to a cold boot.
+func (e *engine) claimWarmVM(ctx context.Context, vm *db.VM, cfg vmconfig.Config) (*db.VM, bool) {
+	if !e.warmPoolEligible(cfg) {
+		return nil, false
+	}
+	key := warmPoolKey(cfg)
+	defer func() { go e.replenishWarmPool(cfg, key) }()
+
+	for {
+		warmName, ok := e.popWarmVM(key)
+		if !ok {
+			return nil, false
+		}
+
+		e.mu.Lock()
+		handle, alive := e.instances[warmName]
+		if alive {
+			delete(e.instances, warmName)
+		}
+		e.mu.Unlock()
+		if !alive {
+			// The member died while pooled; release its record.
+			go func(name string) {
+				if _, err := e.destroyVM(context.Background(), name, false); err != nil {
+					e.logger.Debug("reap dead warm vm", "vm", name, "error", err)
+				}
+			}(warmName)
+			continue
+		}
+
+		claimed, err := e.adoptWarmInstance(ctx, vm, cfg, warmName, handle)
+		if err != nil {
+			e.logger.Warn("claim warm vm", "vm", vm.Name, "warm", warmName, "error", err)
+			_ = handle.instance.Stop(ctx)
+			go func(name string) {
+				if _, err := e.destroyVM(context.Background(), name, false); err != nil {
+					e.logger.Debug("discard warm vm", "vm", name, "error", err)
+				}
+			}(warmName)
+			continue
+		}
+		return claimed, true
+	}
+}
+
+// adoptWarmInstance transfers the warm record's identity onto the
+// claiming VM and re-homes the running instance under the claimed name.
+func (e *engine) adoptWarmInstance(ctx context.Context, vm *db.VM, cfg vmconfig.Config, warmName string, handle processHandle) (*db.VM, error) {
+	var warm *db.VM
+	pid := int64(handle.instance.PID())
+
+	e.allocMu.Lock()
+	err := e.store.WithTx(ctx, func(q db.Queries) error {
+		vmRepo := q.VirtualMachines()
+		record, err := vmRepo.GetByName(ctx, warmName)
+		if err != nil {
+			return err
+		}
+		if record == nil {
+			return fmt.Errorf("warm vm %s record missing", warmName)
+		}
+		warm = record
+		if err := vmRepo.Delete(ctx, warm.ID); err != nil {
+			return err
+		}
+		if vm.IPAddress != "" && vm.IPAddress != warm.IPAddress {
+			if err := q.IPAllocations().Release(ctx, vm.IPAddress); err != nil {
+				return err
+			}
+		}
+		if warm.IPAddress != "" {
+			if err := q.IPAllocations().Assign(ctx, warm.IPAddress, vm.ID); err != nil {
+				return err
+			}
+		}
+		if err := vmRepo.UpdateIdentity(ctx, vm.ID, warm.IPAddress, warm.MACAddress, warm.VsockCID, warm.KernelCmdline); err != nil {
+			return err
+		}
+		if err := vmRepo.UpdateRuntimeState(ctx, vm.ID, db.VMStatusRunning, &pid); err != nil {
+			return err
+		}
+		return vmRepo.UpdateSockets(ctx, vm.ID, handle.serial)
+	})
+	e.allocMu.Unlock()
+	if err != nil {
+		return nil, err
+	}
+
+	// The claimer's freshly allocated identity is gone; hand its IP and
+	// CID back to the in-memory allocators. The adopted warm identity
+	// stays allocated under the new owner.
+	if vm.IPAddress != "" && vm.IPAddress != warm.IPAddress {
+		e.ipam.release(vm.IPAddress)
+	}
+	if vm.VsockCID != warm.VsockCID {
+		e.cids.release(vm.VsockCID)
+	}
+
+	e.mu.Lock()
+	e.instances[vm.Name] = handle
+	e.mu.Unlock()
+	e.monitorInstance(vm.Name, handle)
+
+	vm.IPAddress = warm.IPAddress
+	vm.MACAddress = warm.MACAddress
+	vm.VsockCID = warm.VsockCID
+	vm.KernelCmdline = warm.KernelCmdline
+	vm.SerialSocket = handle.serial
+	vm.Status = db.VMStatusRunning
+	vm.PID = &pid
+	vm.CPUCores = cfg.Resources.CPUCores
+	vm.MemoryMB = cfg.Resources.MemoryMB
+
+	if e.drift != nil && len(cfg.Expose) > 0 {
+		networkCfg := resolveNetworkConfig(cfg.Manifest, &cfg)
+		if err := e.applyDriftRoutes(ctx, *vm, networkCfg, cfg.Expose); err != nil {
+			e.logger.Error("apply drift routes after warm claim", "vm", vm.Name, "error", err)
+		}
+	}
+
+	e.publishEvent(ctx, orchestratorevents.TypeVMRunning, orchestratorevents.VMStatusRunning, vm, "vm claimed from warm pool")
+	return vm, nil
+}
+
+// replenishWarmPool tops a bucket back up to the configured size.
+// Members boot through the regular CreateVM path under reserved
+// volant-warm-* names; at most one fill per bucket runs at a time.
+func (e *engine) replenishWarmPool(cfg vmconfig.Config, key string) {
+	if !e.warmPoolEligible(cfg) {
+		return
+	}
+
+	e.warmMu.Lock()
+	if e.warmFilling[key] {
+		e.warmMu.Unlock()
+		return
+	}
+	e.warmFilling[key] = true
+	need := e.warmPoolSize - len(e.warmPool[key])
+	e.warmMu.Unlock()
+	defer func() {
+		e.warmMu.Lock()
+		delete(e.warmFilling, key)
+		e.warmMu.Unlock()
+	}()
+
+	for i := 0; i < need; i++ {
+		name := warmNamePrefix + randomSuffix()
+		cfgClone := cfg.Clone()
+		cfgClone.Expose = nil
+		var manifestCopy *pluginspec.Manifest
+		if cfgClone.Manifest != nil {
+			copied := *cfgClone.Manifest
+			manifestCopy = &copied
+		}
+		request := CreateVMRequest{
+			Name:              name,
+			Plugin:            cfgClone.Plugin,
+			Runtime:           cfgClone.Runtime,
+			CPUCores:          cfgClone.Resources.CPUCores,
+			MemoryMB:          cfgClone.Resources.MemoryMB,
+			KernelCmdlineHint: cfgClone.KernelCmdline,
+			Manifest:          manifestCopy,
+			APIHost:           cfgClone.API.Host,
+			APIPort:           cfgClone.API.Port,
+			Config:            &cfgClone,
+		}
+		if _, err := e.CreateVM(context.Background(), request); err != nil {
+			e.logger.Warn("fill warm pool", "plugin", cfg.Plugin, "error", err)
+			return
+		}
+		e.warmMu.Lock()
+		e.warmPool[key] = append(e.warmPool[key], name)
+		e.warmMu.Unlock()
+	}
+}
+
+// popWarmVM removes and returns one pooled member name for the key.
+func (e *engine) popWarmVM(key string) (string, bool) {
+	e.warmMu.Lock()
+	defer e.warmMu.Unlock()
+	members := e.warmPool[key]
+	if len(members) == 0 {
+		return "", false
+	}
+	name := members[len(members)-1]
+	e.warmPool[key] = members[:len(members)-1]
+	return name, true
+}
+
+// forgetWarmVM drops a member from whichever bucket holds it, typically
+// because its instance exited while pooled.
+func (e *engine) forgetWarmVM(name string) {
+	e.warmMu.Lock()
+	defer e.warmMu.Unlock()
+	for key, members := range e.warmPool {
+		for i, member := range members {
+			if member == name {
+				e.warmPool[key] = append(members[:i], members[i+1:]...)
+				return
+			}
+		}
+	}
+}
+
+// reapWarmLeftovers destroys pool-owned records left behind by a
+// previous daemon run; their instances died with the old process.
+func (e *engine) reapWarmLeftovers(ctx context.Context) {
+	vms, err := e.store.Queries().VirtualMachines().List(ctx)
+	if err != nil {
+		e.logger.Warn("list vms for warm pool reap", "error", err)
+		return
+	}
+	for _, vm := range vms {
+		if !strings.HasPrefix(vm.Name, warmNamePrefix) {
+			continue
+		}
+		if _, err := e.destroyVM(ctx, vm.Name, false); err != nil {
+			e.logger.Warn("reap stale warm vm", "vm", vm.Name, "error", err)
+		}
+	}
+}
+
+func randomSuffix() string {
+	var buf [4]byte
+	if _, err := rand.Read(buf[:]); err != nil {
+		return "00000000"
+	}
+	return hex.EncodeToString(buf[:])
+}
@@ -21,10 +21,23 @@ type Registry struct {
 	mu        sync.RWMutex
 	backend   db.PluginRepository
 	manifests map[string]pluginspec.Manifest
+	flight    map[string]*fetchCall
+}
+
+// fetchCall tracks one in-progress backend load so concurrent Fetch
+// calls for the same plugin share a single query.
+type fetchCall struct {
+	wg       sync.WaitGroup
+	manifest pluginspec.Manifest
+	err      error
 }
 
 func NewRegistry(repo db.PluginRepository) *Registry {
-	return &Registry{backend: repo, manifests: make(map[string]pluginspec.Manifest)}
+	return &Registry{
+		backend:   repo,
+		manifests: make(map[string]pluginspec.Manifest),
+		flight:    make(map[string]*fetchCall),
+	}
 }
 
 func (r *Registry) Register(manifest pluginspec.Manifest) {
@@ -63,10 +76,44 @@ func (r *Registry) ResolveAction(plugin, action string) (pluginspec.Manifest, pl
 	return manifest, actionSpec, nil
 }
 
+// Fetch resolves a manifest read-through: the in-memory map is checked
+// first, and on a miss all concurrent callers for the same plugin share
+// one backend load whose result is cached for subsequent lookups.
 func (r *Registry) Fetch(ctx context.Context, name string) (pluginspec.Manifest, error) {
 	if r.backend == nil {
 		return pluginspec.Manifest{}, errors.New("registry backend not configured")
 	}
+
+	r.mu.Lock()
+	if manifest, ok := r.manifests[name]; ok {
+		r.mu.Unlock()
+		return manifest, nil
+	}
+	if call, ok := r.flight[name]; ok {
+		r.mu.Unlock()
+		call.wg.Wait()
+		return call.manifest, call.err
+	}
+	call := &fetchCall{}
+	call.wg.Add(1)
+	r.flight[name] = call
+	r.mu.Unlock()
+
+	manifest, err := r.load(ctx, name)
+	call.manifest, call.err = manifest, err
+
+	r.mu.Lock()
+	delete(r.flight, name)
+	if err == nil {
+		r.manifests[name] = manifest
+	}
+	r.mu.Unlock()
+	call.wg.Done()
+
+	return manifest, err
+}
+
+func (r *Registry) load(ctx context.Context, name string) (pluginspec.Manifest, error) {
 	plugin, err := r.backend.GetByName(ctx, name)
 	if err != nil {
 		return pluginspec.Manifest{}, err
@@ -74,6 +121,10 @@ func (r *Registry) Fetch(ctx context.Context, name string) (pluginspec.Manifest,
 	if plugin == nil {
 		return pluginspec.Manifest{}, fmt.Errorf("plugin %s not found", name)
 	}
+	return manifestFromRecord(*plugin)
+}
+
+func manifestFromRecord(plugin db.Plugin) (pluginspec.Manifest, error) {
 	var manifest pluginspec.Manifest
 	if len(plugin.Metadata) > 0 {
 		if err := json.Unmarshal(plugin.Metadata, &manifest); err != nil {
@@ -87,6 +138,43 @@ func (r *Registry) Fetch(ctx context.Context, name string) (pluginspec.Manifest,
 	return manifest, nil
 }
 
+// Prefetch loads every stored manifest into the in-memory map, decoding
+// in parallel, so the first resolution after boot never pays cold-load
+// latency. Manifests that fail to decode are skipped and reported via
+// the joined error; the rest still register.
+func (r *Registry) Prefetch(ctx context.Context) error {
+	if r.backend == nil {
+		return errors.New("registry backend not configured")
+	}
+	entries, err := r.backend.List(ctx)
+	if err != nil {
+		return err
+	}
+
+	var wg sync.WaitGroup
+	decodeErrs := make(chan error, len(entries))
+	for _, entry := range entries {
+		wg.Add(1)
+		go func(entry db.Plugin) {
+			defer wg.Done()
+			manifest, err := manifestFromRecord(entry)
+			if err != nil {
+				decodeErrs <- fmt.Errorf("plugin %s: %w", entry.Name, err)
+				return
+			}
+			r.Register(manifest)
+		}(entry)
+	}
+	wg.Wait()
+	close(decodeErrs)
+
+	var errs []error
+	for err := range decodeErrs {
+		errs = append(errs, err)
+	}
+	return errors.Join(errs...)
+}
+
 func (r *Registry) Persist(ctx context.Context, manifest pluginspec.Manifest, enabled bool) error {
 	if r.backend == nil {
 		return errors.New("registry backend not configured")
@@ -0,0 +1,124 @@
+// Copyright (c) 2025 HYPR. PTE. LTD.
+//
+// Business Source License 1.1
+// See LICENSE file in the project root for details.
+
+// Package telemetry provides always-on latency histograms for hot
+// operations across the daemons. Observations are lock-free atomic
+// increments into power-of-two duration buckets, cheap enough to leave
+// enabled in production, and are rendered in the Prometheus text
+// exposition format by hand to avoid pulling a client library into the
+// binaries (matching the drift metrics endpoint).
+package telemetry
+
+import (
+	"fmt"
+	"io"
+	"math/bits"
+	"net/http"
+	"sort"
+	"strconv"
+	"sync"
+	"sync/atomic"
+	"time"
+)
+
+// bucketCount spans 1µs..~8.4s in power-of-two steps; slower
+// observations land in the +Inf bucket.
+const bucketCount = 24
+
+// Histogram is a fixed-bucket latency histogram safe for concurrent use.
+type Histogram struct {
+	name string
+	help string
+
+	buckets [bucketCount]atomic.Uint64
+	inf     atomic.Uint64
+	sum     atomic.Int64 // nanoseconds
+	count   atomic.Uint64
+}
+
+var (
+	registryMu sync.Mutex
+	registry   = make(map[string]*Histogram)
+)
+
+// NewHistogram registers (or returns the existing) histogram under name.
+func NewHistogram(name, help string) *Histogram {
+	registryMu.Lock()
+	defer registryMu.Unlock()
+	if h, ok := registry[name]; ok {
+		return h
+	}
+	h := &Histogram{name: name, help: help}
+	registry[name] = h
+	return h
+}
+
+// Observe records one duration.
+func (h *Histogram) Observe(d time.Duration) {
+	if d < 0 {
+		d = 0
+	}
+	h.sum.Add(int64(d))
+	h.count.Add(1)
+	idx := bits.Len64(uint64(d.Microseconds()))
+	if idx >= bucketCount {
+		h.inf.Add(1)
+		return
+	}
+	h.buckets[idx].Add(1)
+}
+
+// ObserveSince records the elapsed time since start; pair it with defer
+// at the top of the instrumented operation.
+func (h *Histogram) ObserveSince(start time.Time) {
+	h.Observe(time.Since(start))
+}
+
+// bucketUpperSeconds returns the upper bound of bucket i in seconds.
+func bucketUpperSeconds(i int) float64 {
+	return float64(uint64(1)<<i) / 1e6
+}
+
+func (h *Histogram) write(w io.Writer) {
+	fmt.Fprintf(w, "# HELP %s %s\n", h.name, h.help)
+	fmt.Fprintf(w, "# TYPE %s histogram\n", h.name)
+	cumulative := uint64(0)
+	for i := 0; i < bucketCount; i++ {
+		cumulative += h.buckets[i].Load()
+		le := strconv.FormatFloat(bucketUpperSeconds(i), 'g', -1, 64)
+		fmt.Fprintf(w, "%s_bucket{le=%q} %d\n", h.name, le, cumulative)
+	}
+	fmt.Fprintf(w, "%s_bucket{le=\"+Inf\"} %d\n", h.name, cumulative+h.inf.Load())
+	fmt.Fprintf(w, "%s_sum %g\n", h.name, time.Duration(h.sum.Load()).Seconds())
+	fmt.Fprintf(w, "%s_count %d\n", h.name, h.count.Load())
+}
+
+// WritePrometheus renders every registered histogram to w in the
+// Prometheus text exposition format, in stable name order.
+func WritePrometheus(w io.Writer) {
+	registryMu.Lock()
+	names := make([]string, 0, len(registry))
+	for name := range registry {
+		names = append(names, name)
+	}
+	sort.Strings(names)
+	histograms := make([]*Histogram, 0, len(names))
+	for _, name := range names {
+		histograms = append(histograms, registry[name])
+	}
+	registryMu.Unlock()
+
+	for _, h := range histograms {
+		h.write(w)
+	}
+}
+
+// Handler serves the registered histograms as a metrics endpoint.
+func Handler() http.Handler {
+	return http.HandlerFunc(func(w http.ResponseWriter, r *http.Request) {
+		w.Header().Set("Content-Type", "text/plain; version=0.0.4")
+		WritePrometheus(w)
+	})
+}
@@ -6,13 +6,13 @@
 package vsock
 
 import (
-	"bufio"
 	"context"
 	"encoding/json"
 	"fmt"
 	"io"
 	"net"
 	"net/http"
+	"sync"
 	"time"
 
 	"github.com/mdlayher/vsock"
@@ -23,6 +23,64 @@ type Client struct {
 	cid     uint32
 	port    uint32
 	timeout time.Duration
+	http    *http.Client
+}
+
+// transports pools one keep-alive transport per (CID, port) so every
+// Client for the same guest shares its idle connections, no matter how
+// many Client values callers construct. Without this, health polling
+// and action forwarding pay a fresh vsock handshake per request.
+var (
+	transportMu sync.Mutex
+	transports  = make(map[uint64]*http.Transport)
+)
+
+func transportFor(cid, port uint32) *http.Transport {
+	key := uint64(cid)<<32 | uint64(port)
+	transportMu.Lock()
+	defer transportMu.Unlock()
+	if t, ok := transports[key]; ok {
+		return t
+	}
+	t := &http.Transport{
+		DialContext: func(ctx context.Context, network, addr string) (net.Conn, error) {
+			return dialContext(ctx, cid, port)
+		},
+		MaxIdleConns:        8,
+		MaxIdleConnsPerHost: 8,
+		IdleConnTimeout:     90 * time.Second,
+	}
+	transports[key] = t
+	return t
+}
+
+// dialContext adapts vsock.Dial, which takes no context, so a request
+// against a wedged guest can still be cancelled.
+func dialContext(ctx context.Context, cid, port uint32) (net.Conn, error) {
+	type dialResult struct {
+		conn net.Conn
+		err  error
+	}
+	ch := make(chan dialResult, 1)
+	go func() {
+		conn, err := vsock.Dial(cid, port, nil)
+		if err != nil {
+			ch <- dialResult{err: fmt.Errorf("vsock dial: %w", err)}
+			return
+		}
+		ch <- dialResult{conn: conn}
+	}()
+	select {
+	case res := <-ch:
+		return res.conn, res.err
+	case <-ctx.Done():
+		go func() {
+			if res := <-ch; res.conn != nil {
+				res.conn.Close()
+			}
+		}()
+		return nil, ctx.Err()
+	}
 }
 
 // NewClient creates a vsock client for the specified CID and port.
@@ -32,6 +90,7 @@ func NewClient(cid, port uint32) *Client {
 		cid:     cid,
 		port:    port,
 		timeout: 30 * time.Second,
+		http:    &http.Client{Transport: transportFor(cid, port)},
 	}
 }
 
@@ -41,42 +100,31 @@ func (c *Client) SetTimeout(timeout time.Duration) {
 }
 
 // Do sends an HTTP request over vsock and returns the response.
+// Connections are kept alive and reused across requests; callers must
+// close the response body (fully draining it returns the connection to
+// the pool).
 func (c *Client) Do(ctx context.Context, req *http.Request) (*http.Response, error) {
-	// Create vsock connection
-	conn, err := vsock.Dial(c.cid, c.port, nil)
-	if err != nil {
-		return nil, fmt.Errorf("vsock dial: %w", err)
+	cancel := context.CancelFunc(func() {})
+	if _, ok := ctx.Deadline(); !ok && c.timeout > 0 {
+		ctx, cancel = context.WithTimeout(ctx, c.timeout)
 	}
 
-	// Set deadline
-	deadline, ok := ctx.Deadline()
-	if !ok {
-		deadline = time.Now().Add(c.timeout)
+	req = req.WithContext(ctx)
+	if req.URL.Scheme == "" {
+		req.URL.Scheme = "http"
 	}
-	if err := conn.SetDeadline(deadline); err != nil {
-		conn.Close()
-		return nil, fmt.Errorf("set deadline: %w", err)
+	if req.URL.Host == "" {
+		req.URL.Host = "vsock"
 	}
 
-	// Write HTTP request
-	if err := req.Write(conn); err != nil {
-		conn.Close()
-		return nil, fmt.Errorf("write request: %w", err)
-	}
-
-	// Read HTTP response
-	resp, err := http.ReadResponse(bufio.NewReader(conn), req)
+	resp, err := c.http.Do(req)
 	if err != nil {
-		conn.Close()
-		return nil, fmt.Errorf("read response: %w", err)
-	}
-
-	// Wrap connection to ensure it's closed when response body is closed
-	resp.Body = &connCloser{
-		ReadCloser: resp.Body,
-		conn:       conn,
+		cancel()
+		return nil, err
 	}
 
+	// Keep the request context alive until the body is consumed.
+	resp.Body = &cancelCloser{ReadCloser: resp.Body, cancel: cancel}
 	return resp, nil
 }
 
@@ -129,19 +177,17 @@ func (c *Client) DoJSON(ctx context.Context, method, path string, reqBody, respB
 	return nil
 }
 
-// connCloser wraps a ReadCloser and also closes the underlying connection.
-type connCloser struct {
+// cancelCloser wraps a response body and releases the request context
+// when the body is closed.
+type cancelCloser struct {
 	io.ReadCloser
-	conn net.Conn
+	cancel context.CancelFunc
 }
 
-func (c *connCloser) Close() error {
-	err1 := c.ReadCloser.Close()
-	err2 := c.conn.Close()
-	if err1 != nil {
-		return err1
-	}
-	return err2
+func (c *cancelCloser) Close() error {
+	err := c.ReadCloser.Close()
+	c.cancel()
+	return err
 }
 
 // jsonReader implements io.Reader for byte slices.